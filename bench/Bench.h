@@ -0,0 +1,42 @@
+#ifndef BENCH_H
+#define BENCH_H
+#include <chrono>
+#include <string>
+#include <cstdio>
+
+namespace AbyssBench {
+
+    using Clock = std::chrono::steady_clock;
+
+    inline double secondsSince(Clock::time_point start){
+        return std::chrono::duration<double>(Clock::now() - start).count();
+    }
+
+    // Evita que el compilador elimine el cálculo cuyo resultado no se usa
+    template <typename T>
+    inline void doNotOptimize(const T& value){
+        asm volatile("" : : "r,m"(value) : "memory");
+    }
+
+    // Línea de resultado con formato fijo: [bench] métrica = valor unidad
+    inline void report(const std::string& bench, const std::string& metric, double value, const std::string& unit){
+        std::printf("[%s] %-40s = %14.2f %s\n", bench.c_str(), metric.c_str(), value, unit.c_str());
+    }
+
+    // Cada benchmark se registra en BenchMain.cpp
+    void runColumnReadBench();
+    void runSectionScanBench();
+    void runNeighborReadBench();
+    void runMemoryBench();
+    void runPoolBench();
+    void runSectionSizeBench();
+    void runVoxelLayoutBench();
+    void runRaycastBench();
+    void runLightBench();
+    void runLightParallelBench();
+    void runRandomTickBench();
+    void runScheduledTickBench();
+    void runFluidBench();
+}
+
+#endif // BENCH_H
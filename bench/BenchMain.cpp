@@ -0,0 +1,45 @@
+#include "Bench.h"
+#include <cstring>
+
+/**
+ * @brief Punto de entrada de los benchmarks del motor de mundo.
+ *
+ * Sin argumentos ejecuta todos; con argumentos solo los que coinciden por nombre.
+ * Ejemplo: ./AbyssBench column_read
+ */
+struct BenchEntry {
+    const char* name;
+    void (*run)();
+};
+
+static const BenchEntry BENCHMARKS[] = {
+    {"column_read", AbyssBench::runColumnReadBench},
+    {"section_scan", AbyssBench::runSectionScanBench},
+    {"neighbor_read", AbyssBench::runNeighborReadBench},
+    {"memory", AbyssBench::runMemoryBench},
+    {"pool_churn", AbyssBench::runPoolBench},
+    {"section_size", AbyssBench::runSectionSizeBench},
+    {"voxel_layout", AbyssBench::runVoxelLayoutBench},
+    {"raycast", AbyssBench::runRaycastBench},
+    {"light", AbyssBench::runLightBench},
+    {"light_parallel", AbyssBench::runLightParallelBench},
+    {"random_tick", AbyssBench::runRandomTickBench},
+    {"scheduled_tick", AbyssBench::runScheduledTickBench},
+    {"fluid", AbyssBench::runFluidBench},
+};
+
+int main(int argc, char* argv[]){
+    for(const BenchEntry& entry : BENCHMARKS){
+        bool selected = (argc < 2);
+        for(int i = 1; i < argc; ++i){
+            if(strcmp(argv[i], entry.name) == 0){
+                selected = true;
+            }
+        }
+        if(selected){
+            std::printf("=== %s ===\n", entry.name);
+            entry.run();
+        }
+    }
+    return 0;
+}
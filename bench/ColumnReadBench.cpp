@@ -0,0 +1,76 @@
+#include "Bench.h"
+#include "world/ChunkColumn.h"
+#include "world/BlockRegistry.h"
+#include <thread>
+#include <vector>
+#include <random>
+#include <atomic>
+#include <algorithm>
+
+namespace AbyssBench {
+
+    using namespace AbyssCore;
+
+    /**
+     * @brief Mide lecturas/segundo de ChunkColumn::getBlock con 1..N hilos sobre la misma columna.
+     *
+     * La columna tiene 384 bloques de alto con una mezcla de piedra, tierra y menas para que las
+     * secciones no sean uniformes. Cada hilo recorre su propia secuencia pseudoaleatoria.
+     */
+    void runColumnReadBench(){
+        constexpr int MIN_Y = -64;
+        constexpr int MAX_Y = 320;
+        constexpr int READS_PER_THREAD = 4000000;
+
+        BlockRegistry::getInstance().init([](const std::string&){ return 0; });
+        const BlockRegistry& registry = BlockRegistry::getInstance();
+        const BlockID stone = registry.getBaseState(BLOCK_STONE), dirt = registry.getBaseState(BLOCK_DIRT);
+        const BlockID coal = registry.getBaseState(BLOCK_COAL), iron = registry.getBaseState(BLOCK_IRON);
+
+        ChunkColumn column(0, 0);
+        std::mt19937 rng(1234);
+        for(int y = MIN_Y; y < MAX_Y; y++){
+            for(int z = 0; z < CHUNK_SECTION_SIZE; z++){
+                for(int x = 0; x < CHUNK_SECTION_SIZE; x++){
+                    const unsigned roll = rng() % 100;
+                    const BlockID block = (roll < 70) ? stone : (roll < 90) ? dirt : (roll < 97) ? coal : iron;
+                    column.setBlock(x, y, z, block);
+                }
+            }
+        }
+
+        const int maxThreads = std::max(4u, std::thread::hardware_concurrency());
+        for(int threads = 1; threads <= maxThreads; threads *= 2){
+            std::atomic<uint64_t> checksum(0);
+            std::vector<std::thread> workers;
+            Clock::time_point start = Clock::now();
+            for(int t = 0; t < threads; t++){
+                workers.emplace_back([&column, &checksum, t](){
+                    // Un guard por trabajo: el de cada getBlock solo anida
+                    EpochGuard guard;
+                    uint32_t state = 0x9E3779B9u * (t + 1);
+                    uint64_t sum = 0;
+                    for(int i = 0; i < READS_PER_THREAD; i++){
+                        // xorshift32: barato y suficiente para repartir accesos
+                        state ^= state << 13;
+                        state ^= state >> 17;
+                        state ^= state << 5;
+                        const int x = state & CHUNK_SECTION_MASK;
+                        const int z = (state >> CHUNK_SECTION_SIZE_LOG2) & CHUNK_SECTION_MASK;
+                        const int y = MIN_Y + static_cast<int>((state >> CHUNK_SECTION_LAYER_LOG2) % (MAX_Y - MIN_Y));
+                        sum += column.getBlock(x, y, z);
+                    }
+                    checksum += sum;
+                });
+            }
+            for(std::thread& worker : workers){
+                worker.join();
+            }
+            const double seconds = secondsSince(start);
+            doNotOptimize(checksum.load());
+
+            const double total = static_cast<double>(READS_PER_THREAD) * threads;
+            report("column_read", "getBlock threads=" + std::to_string(threads), total / seconds / 1e6, "Mreads/s");
+        }
+    }
+}
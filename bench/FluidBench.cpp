@@ -0,0 +1,121 @@
+#include "Bench.h"
+#include "world/FluidSimulation.h"
+#include <vector>
+#include <thread>
+#include <algorithm>
+#include <cmath>
+
+namespace AbyssBench {
+
+    using namespace AbyssCore;
+
+    static constexpr int FLUID_COLUMNS_PER_AXIS = 16;
+    static constexpr int FLUID_MIN_Y = -64;
+    static constexpr int FLUID_MAX_Y = 64;
+    static constexpr int CAVE_CEILING = 40;
+    static constexpr int SOURCE_SPACING = 8;
+    static constexpr int MAX_STEPS = 10000;
+
+    /**
+     * @brief Cueva de roca que ocupa casi todo el mundo, con suelo irregular y pilares.
+     * @return Número de celdas de aire dentro de la cueva
+     */
+    static int buildCave(World& world){
+        const BlockRegistry& registry = BlockRegistry::getInstance();
+        const BlockID stone = registry.getBaseState(BLOCK_STONE);
+        const int size = FLUID_COLUMNS_PER_AXIS * CHUNK_SECTION_SIZE;
+        int air = 0;
+        for(int z = 0; z < size; z++){
+            for(int x = 0; x < size; x++){
+                ChunkColumn* column = world.getOrCreateColumn(World::toChunkCoord(x), World::toChunkCoord(z));
+                const int lx = World::toLocalCoord(x), lz = World::toLocalCoord(z);
+                column->fillBox(lx, FLUID_MIN_Y, lz, lx, FLUID_MAX_Y, lz, stone);
+                // Borde de roca para que el agua no se salga del mundo cargado
+                if(x == 0 || z == 0 || x == size - 1 || z == size - 1){
+                    continue;
+                }
+                const bool pillar = (x % 37 < 3) && (z % 41 < 3);
+                if(pillar){
+                    continue;
+                }
+                const int floor = static_cast<int>(10.0 * std::sin(x * 0.05) * std::cos(z * 0.07) + 6.0 * std::sin((x + z) * 0.02));
+                column->fillBox(lx, floor, lz, lx, CAVE_CEILING - 1, lz, 0);
+                air += CAVE_CEILING - floor;
+            }
+        }
+        return air;
+    }
+
+    /**
+     * @brief Inunda la cueva con fuentes de agua en el techo y cuenta lo que hace falta para asentarla.
+     */
+    static void floodCave(int workerThreads, std::vector<BlockID>* snapshot){
+        World world;
+        const int air = buildCave(world);
+        const BlockID water = BlockRegistry::getInstance().getBaseState(BLOCK_WATER);
+        const int size = FLUID_COLUMNS_PER_AXIS * CHUNK_SECTION_SIZE;
+
+        FluidSimulation fluids(world, workerThreads);
+        int sources = 0;
+        for(int z = SOURCE_SPACING / 2; z < size - 1; z += SOURCE_SPACING){
+            for(int x = SOURCE_SPACING / 2; x < size - 1; x += SOURCE_SPACING){
+                if(world.getBlock(x, CAVE_CEILING - 1, z) == 0){
+                    world.setBlock(x, CAVE_CEILING - 1, z, water);
+                    fluids.onBlockChanged(x, CAVE_CEILING - 1, z);
+                    sources++;
+                }
+            }
+        }
+
+        // Pasos seguidos del agua (índice 0) sin esperar a su tickDelay, hasta que su frente se vacía
+        int steps = 0, peak = 0;
+        Clock::time_point start = Clock::now();
+        for(int evaluated = fluids.step(0); evaluated != 0 && steps < MAX_STEPS; evaluated = fluids.step(0)){
+            peak = std::max(peak, evaluated);
+            steps++;
+        }
+        const double seconds = secondsSince(start);
+
+        const std::string label = std::to_string(workerThreads + 1) + " thread(s)";
+        report("fluid", label + " cells processed", fluids.getCellsProcessed() / seconds / 1e6, "M cells/s");
+        report("fluid", label + " time to settle", seconds * 1e3, "ms");
+        if(workerThreads == 0){
+            report("fluid", "cave air cells", air, "cells");
+            report("fluid", "water sources", sources, "sources");
+            report("fluid", "steps to settle", steps, "steps");
+            report("fluid", "peak active frontier", peak, "cells");
+            report("fluid", "cells evaluated per step", double(fluids.getCellsProcessed()) / steps, "cells");
+            report("fluid", "full-volume evaluation avoided", 100.0 * (1.0 - double(fluids.getCellsProcessed()) / (double(air) * steps)), "%");
+        }
+
+        std::vector<BlockID> blocks;
+        blocks.reserve(static_cast<std::size_t>(size) * size * (CAVE_CEILING - FLUID_MIN_Y));
+        for(int y = FLUID_MIN_Y; y < CAVE_CEILING; y++){
+            for(int z = 0; z < size; z++){
+                for(int x = 0; x < size; x++){
+                    blocks.push_back(world.getBlock(x, y, z));
+                }
+            }
+        }
+        if(snapshot->empty()){
+            *snapshot = std::move(blocks);
+        }else if(*snapshot != blocks){
+            report("fluid", label + " MISMATCH with serial result", 1, "");
+        }
+    }
+
+    /**
+     * @brief Inundación de una cueva de 16x16 columnas con el frente activo de FluidSimulation.
+     *
+     * Se repite con 1, 2, 4... hilos hasta los de la máquina y comprueba que el resultado es el
+     * mismo bloque a bloque que el de un solo hilo.
+     */
+    void runFluidBench(){
+        BlockRegistry::getInstance().init([](const std::string&){ return 0; });
+        const int cores = std::max(1, static_cast<int>(std::thread::hardware_concurrency()));
+        std::vector<BlockID> snapshot;
+        for(int threads = 1; threads <= cores; threads *= 2){
+            floodCave(threads - 1, &snapshot);
+        }
+    }
+}
@@ -0,0 +1,202 @@
+#include "Bench.h"
+#include "world/LightEngine.h"
+#include "world/LightScheduler.h"
+#include <vector>
+#include <random>
+#include <cmath>
+#include <thread>
+#include <algorithm>
+
+namespace AbyssBench {
+
+    using namespace AbyssCore;
+
+    static constexpr int COLUMNS_PER_AXIS = 16;
+    static constexpr int MIN_Y = -64;
+    static constexpr int CHANGES = 20000;
+
+    // Terreno con colinas, cuevas, árboles y alguna lámpara bajo tierra
+    static void generate(World& world, std::mt19937& rng){
+        const BlockRegistry& registry = BlockRegistry::getInstance();
+        const BlockID stone = registry.getBaseState(BLOCK_STONE);
+        const BlockID dirt = registry.getBaseState(BLOCK_DIRT);
+        const BlockID grass = registry.getBaseState(BLOCK_GRASS);
+        const BlockID log = registry.getBaseState(BLOCK_LOG);
+        const BlockID leaves = registry.getBaseState(BLOCK_LEAVES);
+        const BlockID lamp = registry.getBaseState(BLOCK_LAMP);
+        const int size = COLUMNS_PER_AXIS * CHUNK_SECTION_SIZE;
+
+        for(int z = 0; z < size; z++){
+            for(int x = 0; x < size; x++){
+                const int h = 48 + static_cast<int>(10.0 * std::sin(x * 0.05) * std::cos(z * 0.04));
+                ChunkColumn* column = world.getOrCreateColumn(World::toChunkCoord(x), World::toChunkCoord(z));
+                const int lx = World::toLocalCoord(x), lz = World::toLocalCoord(z);
+                column->fillBox(lx, MIN_Y, lz, lx, h - 4, lz, stone);
+                column->fillBox(lx, h - 3, lz, lx, h - 1, lz, dirt);
+                column->setBlock(lx, h, lz, grass);
+            }
+        }
+        for(int i = 0; i < COLUMNS_PER_AXIS * COLUMNS_PER_AXIS; i++){
+            const int x = 4 + rng() % (size - 8), z = 4 + rng() % (size - 8);
+            int y = 0;
+            while(world.getBlock(x, y + 1, z) != 0){
+                y++;
+            }
+            for(int dy = 1; dy <= 4; dy++){
+                world.setBlock(x, y + dy, z, log);
+            }
+            for(int dz = -2; dz <= 2; dz++){
+                for(int dx = -2; dx <= 2; dx++){
+                    for(int dy = 4; dy <= 6; dy++){
+                        if(world.getBlock(x + dx, y + dy, z + dz) == 0){
+                            world.setBlock(x + dx, y + dy, z + dz, leaves);
+                        }
+                    }
+                }
+            }
+        }
+        for(int i = 0; i < COLUMNS_PER_AXIS * COLUMNS_PER_AXIS / 2; i++){
+            const int x = rng() % size, y = rng() % 80 - 40, z = rng() % size;
+            for(int dy = -2; dy <= 2; dy++){
+                for(int dz = -3; dz <= 3; dz++){
+                    for(int dx = -3; dx <= 3; dx++){
+                        world.setBlock(x + dx, y + dy, z + dz, 0);
+                    }
+                }
+            }
+            world.setBlock(x, y - 2, z, lamp);
+        }
+    }
+
+    /**
+     * @brief Coste de iluminar columnas nuevas y de reaccionar a cambios de bloques.
+     *
+     * - lightColumn: 16x16 columnas de 8 secciones iluminadas en orden de carga (cada una
+     *   propaga también hacia las vecinas ya cargadas).
+     * - cambios: poner y quitar piedra sobre la superficie (sombra de cielo) y lámparas bajo tierra,
+     *   cada uno con su update().
+     */
+    void runLightBench(){
+        BlockRegistry::getInstance().init([](const std::string&){ return 0; });
+        World world;
+        std::mt19937 rng(9);
+        generate(world, rng);
+        LightEngine light(world);
+
+        Clock::time_point start = Clock::now();
+        for(int cz = 0; cz < COLUMNS_PER_AXIS; cz++){
+            for(int cx = 0; cx < COLUMNS_PER_AXIS; cx++){
+                light.lightColumn(cx, cz);
+            }
+        }
+        const int columns = COLUMNS_PER_AXIS * COLUMNS_PER_AXIS;
+        report("light", "lightColumn", secondsSince(start) * 1e6 / columns, "us/column");
+
+        int sections = 0, mixedSky = 0, mixedBlock = 0;
+        world.forEachColumn([&](const ChunkColumn* column){
+            for(int sy = column->getMinSectionY(); sy <= column->getMaxSectionY(); sy++){
+                const ChunkSection* section = column->findSection(sy);
+                sections++;
+                mixedSky += !section->getLightArray(LIGHT_SKY).isUniform();
+                mixedBlock += !section->getLightArray(LIGHT_BLOCK).isUniform();
+            }
+        });
+        report("light", "sections with sky array", 100.0 * mixedSky / sections, "%");
+        report("light", "sections with block light array", 100.0 * mixedBlock / sections, "%");
+
+        const int size = COLUMNS_PER_AXIS * CHUNK_SECTION_SIZE;
+        const BlockID stone = BlockRegistry::getInstance().getBaseState(BLOCK_STONE);
+        const BlockID lamp = BlockRegistry::getInstance().getBaseState(BLOCK_LAMP);
+        std::vector<int> positions(CHANGES * 3);
+        for(int i = 0; i < CHANGES; i++){
+            positions[i * 3] = 16 + rng() % (size - 32);
+            positions[i * 3 + 2] = 16 + rng() % (size - 32);
+        }
+
+        start = Clock::now();
+        for(int i = 0; i < CHANGES; i++){
+            const int x = positions[i * 3], z = positions[i * 3 + 2];
+            const int y = 62;   // Por encima de todo el terreno: corta una columna de cielo
+            light.setBlock(x, y, z, stone);
+            light.update();
+            light.setBlock(x, y, z, 0);
+            light.update();
+        }
+        report("light", "sky block place + remove", secondsSince(start) * 1e6 / (CHANGES * 2), "us/change");
+
+        start = Clock::now();
+        for(int i = 0; i < CHANGES; i++){
+            const int x = positions[i * 3], z = positions[i * 3 + 2];
+            light.setBlock(x, 20, z, lamp);
+            light.update();
+            light.setBlock(x, 20, z, stone);
+            light.update();
+        }
+        report("light", "buried lamp place + remove", secondsSince(start) * 1e6 / (CHANGES * 2), "us/change");
+
+        // Lámpara en el aire: ilumina una esfera completa de radio 14
+        start = Clock::now();
+        for(int i = 0; i < CHANGES / 10; i++){
+            const int x = positions[i * 3], z = positions[i * 3 + 2];
+            light.setBlock(x, 90, z, lamp);
+            light.update();
+            light.setBlock(x, 90, z, 0);
+            light.update();
+        }
+        report("light", "open-air lamp place + remove", secondsSince(start) * 1e6 / (CHANGES / 10 * 2), "us/change");
+    }
+
+    /**
+     * @brief Iluminación inicial de todas las columnas a la vez (el jugador entra en terreno nuevo).
+     *
+     * El mismo terreno de 16x16 columnas con LightEngine en serie y con LightScheduler de 1 a N
+     * hilos. Cuenta además las celdas cuya luz difiere del resultado en serie (debe ser 0).
+     */
+    void runLightParallelBench(){
+        BlockRegistry::getInstance().init([](const std::string&){ return 0; });
+        const int columns = COLUMNS_PER_AXIS * COLUMNS_PER_AXIS;
+        const int size = COLUMNS_PER_AXIS * CHUNK_SECTION_SIZE;
+
+        World reference;
+        std::mt19937 rng(9);
+        generate(reference, rng);
+        LightEngine serial(reference);
+        Clock::time_point start = Clock::now();
+        for(int cz = 0; cz < COLUMNS_PER_AXIS; cz++){
+            for(int cx = 0; cx < COLUMNS_PER_AXIS; cx++){
+                serial.lightColumn(cx, cz);
+            }
+        }
+        report("light_parallel", "LightEngine serial", secondsSince(start) * 1e6 / columns, "us/column");
+
+        const int maxThreads = std::max(4u, std::thread::hardware_concurrency());
+        for(int threads = 1; threads <= maxThreads; threads *= 2){
+            World world;
+            std::mt19937 worldRng(9);
+            generate(world, worldRng);
+            LightScheduler scheduler(world, threads - 1);
+
+            start = Clock::now();
+            for(int cz = 0; cz < COLUMNS_PER_AXIS; cz++){
+                for(int cx = 0; cx < COLUMNS_PER_AXIS; cx++){
+                    scheduler.requestColumn(cx, cz);
+                }
+            }
+            scheduler.update();
+            report("light_parallel", "LightScheduler " + std::to_string(threads) + " threads",
+                   secondsSince(start) * 1e6 / columns, "us/column");
+            report("light_parallel", "  regions kept after update", double(scheduler.getRegionCount()), "regions");
+
+            int mismatches = 0;
+            for(int y = MIN_Y; y < 128; y++){
+                for(int z = 0; z < size; z++){
+                    for(int x = 0; x < size; x++){
+                        mismatches += scheduler.getLight(LIGHT_SKY, x, y, z) != serial.getLight(LIGHT_SKY, x, y, z);
+                        mismatches += scheduler.getLight(LIGHT_BLOCK, x, y, z) != serial.getLight(LIGHT_BLOCK, x, y, z);
+                    }
+                }
+            }
+            report("light_parallel", "cells differing from serial", mismatches, "");
+        }
+    }
+}
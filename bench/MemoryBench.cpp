@@ -0,0 +1,70 @@
+#include "Bench.h"
+#include "world/World.h"
+#include "world/BlockRegistry.h"
+#include "utils/MemoryStats.h"
+#include <random>
+
+namespace AbyssBench {
+
+    using namespace AbyssCore;
+
+    /**
+     * @brief Carga N columnas de terreno y mide los bytes por columna de cada subsistema.
+     *
+     * Terreno típico: piedra con menas dispersas hasta y=48, tres capas de tierra, césped
+     * y aire por encima. Las secciones enteras de piedra o aire quedan uniformes, así que la
+     * cifra refleja el coste real de un mundo generado y no el peor caso.
+     */
+    void runMemoryBench(){
+        constexpr int COLUMNS_PER_AXIS = 16;
+        constexpr int MIN_Y = -64;
+        constexpr int STONE_TOP = 48;
+        BlockRegistry::getInstance().init([](const std::string&){ return 0; });
+        const BlockRegistry& registry = BlockRegistry::getInstance();
+        const BlockID STONE = registry.getBaseState(BLOCK_STONE), DIRT = registry.getBaseState(BLOCK_DIRT);
+        const BlockID GRASS = registry.getBaseState(BLOCK_GRASS);
+        const BlockID COAL = registry.getBaseState(BLOCK_COAL), IRON = registry.getBaseState(BLOCK_IRON);
+
+        World world;
+        std::mt19937 rng(42);
+        for(int cz = 0; cz < COLUMNS_PER_AXIS; cz++){
+            for(int cx = 0; cx < COLUMNS_PER_AXIS; cx++){
+                ChunkColumn* column = world.getOrCreateColumn(cx, cz);
+                column->fillBox(0, MIN_Y, 0, CHUNK_SECTION_MASK, STONE_TOP - 1, CHUNK_SECTION_MASK, STONE);
+                column->fillBox(0, STONE_TOP, 0, CHUNK_SECTION_MASK, STONE_TOP + 2, CHUNK_SECTION_MASK, DIRT);
+                column->fillLayer(STONE_TOP + 3, GRASS);
+                // Menas solo en la franja baja: el resto de secciones de piedra siguen uniformes
+                for(int i = 0; i < 96; i++){
+                    const int x = rng() % CHUNK_SECTION_SIZE;
+                    const int z = rng() % CHUNK_SECTION_SIZE;
+                    const int y = MIN_Y + static_cast<int>(rng() % 48);
+                    column->setBlock(x, y, z, (i & 3) ? COAL : IRON);
+                }
+            }
+        }
+
+        const int columns = COLUMNS_PER_AXIS * COLUMNS_PER_AXIS;
+        int sections = 0;
+        world.forEachColumn([&sections](const ChunkColumn* column){
+            for(int sy = column->getMinSectionY(); sy <= column->getMaxSectionY(); sy++){
+                sections += column->findSection(sy) != nullptr;
+            }
+        });
+
+        MemoryReport usage = MemoryStats::getInstance().collect();
+        Clock::time_point start = Clock::now();
+        world.accountMemory(usage);
+        const double accountMs = secondsSince(start) * 1000.0;
+
+        report("memory", "columns loaded", columns, "");
+        report("memory", "sections loaded", sections, "");
+        for(int category = 0; category < MEMORY_CATEGORY_COUNT; category++){
+            const MemoryCategory type = static_cast<MemoryCategory>(category);
+            report("memory", std::string(MemoryStats::categoryName(type)) + " per column",
+                   static_cast<double>(usage.bytes[category]) / columns, "B");
+        }
+        report("memory", "total per column", static_cast<double>(usage.total()) / columns, "B");
+        report("memory", "bytes per section", static_cast<double>(usage.bytes[MEMORY_SECTIONS]) / sections, "B");
+        report("memory", "accountMemory time", accountMs, "ms");
+    }
+}
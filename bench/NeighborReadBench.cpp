@@ -0,0 +1,92 @@
+#include "Bench.h"
+#include "world/BlockCursor.h"
+#include "world/BlockRegistry.h"
+#include <vector>
+#include <random>
+
+namespace AbyssBench {
+
+    using namespace AbyssCore;
+
+    /**
+     * @brief Lecturas de los 6 vecinos de cada bloque de una región 3x3 columnas x 64 de alto.
+     *
+     * Compara World::getBlock (resuelve columna y sección en cada lectura), BlockCursor y un
+     * array denso plano como referencia de velocidad máxima.
+     */
+    void runNeighborReadBench(){
+        constexpr int SIZE_XZ = 48;
+        constexpr int HEIGHT = 64;
+        constexpr int PASSES = 10;
+        BlockRegistry::getInstance().init([](const std::string&){ return 0; });
+        const BlockID stone = BlockRegistry::getInstance().getBaseState(BLOCK_STONE);
+        const BlockID coal = BlockRegistry::getInstance().getBaseState(BLOCK_COAL);
+
+        World world;
+        std::vector<BlockID> dense(static_cast<std::size_t>(SIZE_XZ + 2) * (HEIGHT + 2) * (SIZE_XZ + 2), 0);
+        auto denseIndex = [](int x, int y, int z){
+            return (static_cast<std::size_t>(y + 1) * (SIZE_XZ + 2) + (z + 1)) * (SIZE_XZ + 2) + (x + 1);
+        };
+        std::mt19937 rng(7);
+        for(int y = 0; y < HEIGHT; y++){
+            for(int z = 0; z < SIZE_XZ; z++){
+                for(int x = 0; x < SIZE_XZ; x++){
+                    const BlockID block = (y < 40) ? ((rng() % 20 == 0) ? coal : stone) : 0;
+                    world.setBlock(x, y, z, block);
+                    dense[denseIndex(x, y, z)] = block;
+                }
+            }
+        }
+        const double reads = 6.0 * SIZE_XZ * SIZE_XZ * HEIGHT * PASSES;
+
+        uint64_t sum = 0;
+        EpochGuard guard; // Como haría un trabajo de mallado: un guard para todo el recorrido
+        Clock::time_point start = Clock::now();
+        for(int pass = 0; pass < PASSES; pass++){
+            for(int y = 0; y < HEIGHT; y++){
+                for(int z = 0; z < SIZE_XZ; z++){
+                    for(int x = 0; x < SIZE_XZ; x++){
+                        for(const int* offset : FACE_OFFSETS){
+                            sum += world.getBlock(x + offset[0], y + offset[1], z + offset[2]);
+                        }
+                    }
+                }
+            }
+        }
+        report("neighbor_read", "World::getBlock", reads / secondsSince(start) / 1e6, "Mreads/s");
+
+        start = Clock::now();
+        BlockCursor cursor(world);
+        BlockID faces[6];
+        for(int pass = 0; pass < PASSES; pass++){
+            for(int y = 0; y < HEIGHT; y++){
+                for(int z = 0; z < SIZE_XZ; z++){
+                    cursor.moveTo(0, y, z);
+                    for(int x = 0; x < SIZE_XZ; x++){
+                        cursor.getFaceNeighbors(faces);
+                        for(BlockID face : faces){
+                            sum += face;
+                        }
+                        cursor.move(1, 0, 0);
+                    }
+                }
+            }
+        }
+        report("neighbor_read", "BlockCursor", reads / secondsSince(start) / 1e6, "Mreads/s");
+
+        start = Clock::now();
+        for(int pass = 0; pass < PASSES; pass++){
+            for(int y = 0; y < HEIGHT; y++){
+                for(int z = 0; z < SIZE_XZ; z++){
+                    for(int x = 0; x < SIZE_XZ; x++){
+                        for(const int* offset : FACE_OFFSETS){
+                            sum += dense[denseIndex(x + offset[0], y + offset[1], z + offset[2])];
+                        }
+                    }
+                }
+            }
+        }
+        report("neighbor_read", "array denso (referencia)", reads / secondsSince(start) / 1e6, "Mreads/s");
+        doNotOptimize(sum);
+    }
+}
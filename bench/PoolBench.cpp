@@ -0,0 +1,70 @@
+#include "Bench.h"
+#include "world/ChunkColumn.h"
+#include <thread>
+#include <vector>
+#include <cstdlib>
+#include <algorithm>
+
+namespace AbyssBench {
+
+    using namespace AbyssCore;
+
+    /**
+     * @brief Rachas de creación/destrucción de secciones como en la carga y descarga de chunks.
+     *
+     * Cada hilo crea un lote de secciones y las destruye en orden inverso, repetidas veces.
+     * Se compara el pool de ChunkSection con malloc/free del mismo tamaño (sin constructor).
+     */
+    void runPoolBench(){
+        constexpr int BATCH = 4096;
+        constexpr int ROUNDS = 200;
+
+        const int maxThreads = std::max(4u, std::thread::hardware_concurrency());
+        for(int threads = 1; threads <= maxThreads; threads *= 2){
+            for(int usePool = 0; usePool <= 1; usePool++){
+                std::vector<std::thread> workers;
+                Clock::time_point start = Clock::now();
+                for(int t = 0; t < threads; t++){
+                    workers.emplace_back([usePool](){
+                        std::vector<void*> live(BATCH);
+                        for(int round = 0; round < ROUNDS; round++){
+                            for(int i = 0; i < BATCH; i++){
+                                live[i] = usePool ? ChunkSection::getPool().allocate() : std::malloc(sizeof(ChunkSection));
+                                doNotOptimize(live[i]);
+                            }
+                            for(int i = BATCH - 1; i >= 0; i--){
+                                if(usePool){
+                                    ChunkSection::getPool().deallocate(live[i]);
+                                }else{
+                                    std::free(live[i]);
+                                }
+                            }
+                        }
+                    });
+                }
+                for(std::thread& worker : workers){
+                    worker.join();
+                }
+                const double seconds = secondsSince(start);
+                const double ops = 2.0 * BATCH * ROUNDS * threads;
+                report("pool_churn", std::string(usePool ? "pool " : "malloc ") + std::to_string(threads) + " threads",
+                       ops / seconds / 1e6, "Mops/s");
+            }
+        }
+
+        // Ciclo real de secciones construidas y estadísticas del pool
+        {
+            std::vector<ChunkSection*> sections;
+            for(int i = 0; i < BATCH; i++){
+                sections.push_back(new ChunkSection(i, 1));
+            }
+            const PoolStats stats = ChunkSection::getPool().getStats();
+            report("pool_churn", "sections live", stats.live, "");
+            report("pool_churn", "sections free slots", stats.free, "");
+            report("pool_churn", "section slabs", stats.slabs, "");
+            for(ChunkSection* section : sections){
+                delete section;
+            }
+        }
+    }
+}
@@ -0,0 +1,126 @@
+#include "Bench.h"
+#include "world/Raycast.h"
+#include <vector>
+#include <random>
+#include <cmath>
+
+namespace AbyssBench {
+
+    using namespace AbyssCore;
+
+    static constexpr int TERRAIN_XZ = 256;
+    static constexpr int RAY_COUNT = 200000;
+
+    /**
+     * @brief Referencia: el mismo DDA pero leyendo cada vóxel con World::getBlock, sin caché ni saltos.
+     */
+    static bool naiveCast(const World& world, const Ray& ray){
+        const double length = std::sqrt(double(ray.direction[0]) * ray.direction[0] +
+                                        double(ray.direction[1]) * ray.direction[1] +
+                                        double(ray.direction[2]) * ray.direction[2]);
+        int voxel[3], step[3];
+        double tMax[3], tDelta[3];
+        for(int axis = 0; axis < 3; axis++){
+            const double dir = ray.direction[axis] / length;
+            voxel[axis] = static_cast<int>(std::floor(ray.origin[axis]));
+            step[axis] = (dir > 0.0) ? 1 : (dir < 0.0) ? -1 : 0;
+            tDelta[axis] = (step[axis] != 0) ? std::fabs(1.0 / dir) : 1e30;
+            tMax[axis] = (step[axis] > 0) ? (voxel[axis] + 1 - ray.origin[axis]) / dir
+                       : (step[axis] < 0) ? (voxel[axis] - ray.origin[axis]) / dir : 1e30;
+        }
+        for(;;){
+            if(world.getBlock(voxel[0], voxel[1], voxel[2]) != 0){
+                return true;
+            }
+            int axis = (tMax[0] < tMax[1]) ? 0 : 1;
+            axis = (tMax[2] < tMax[axis]) ? 2 : axis;
+            if(tMax[axis] > ray.maxDistance){
+                return false;
+            }
+            voxel[axis] += step[axis];
+            tMax[axis] += tDelta[axis];
+        }
+    }
+
+    static void measure(const World& world, const std::string& name, const std::vector<Ray>& rays){
+        std::vector<RayHit> hits(rays.size());
+        uint64_t hitCount = 0;
+        EpochGuard guard;
+
+        Clock::time_point start = Clock::now();
+        for(const Ray& ray : rays){
+            hitCount += naiveCast(world, ray);
+        }
+        report("raycast", name + " World::getBlock DDA", rays.size() / secondsSince(start) / 1e6, "Mrays/s");
+
+        start = Clock::now();
+        Raycaster raycaster(world, RAY_HIT_ANY);
+        raycaster.castBatch(rays.data(), static_cast<int>(rays.size()), hits.data());
+        const double seconds = secondsSince(start);
+        report("raycast", name + " Raycaster", rays.size() / seconds / 1e6, "Mrays/s");
+        report("raycast", name + " blocks visited per ray", double(raycaster.getVisitedBlocks()) / rays.size(), "");
+        for(const RayHit& hit : hits){
+            hitCount += hit.hit;
+        }
+        doNotOptimize(hitCount);
+    }
+
+    /**
+     * @brief Rayos sobre un terreno de 256x256 con cuevas en tres situaciones típicas.
+     *
+     * - pick: selección de bloque desde la cámara, alcance 8, mirando hacia abajo.
+     * - sight: línea de visión de 128 bloques por encima del terreno (casi todo aire: saltos de sección).
+     * - explosion: rayos en todas direcciones desde el centro de una sala bajo tierra, en un único lote.
+     */
+    void runRaycastBench(){
+        World world;
+        std::mt19937 rng(5);
+        for(int z = 0; z < TERRAIN_XZ; z++){
+            for(int x = 0; x < TERRAIN_XZ; x++){
+                const int h = 40 + static_cast<int>(12.0 * std::sin(x * 0.05) * std::cos(z * 0.04));
+                ChunkColumn* column = world.getOrCreateColumn(World::toChunkCoord(x), World::toChunkCoord(z));
+                const int lx = World::toLocalCoord(x), lz = World::toLocalCoord(z);
+                column->fillBox(lx, -64, lz, lx, h - 1, lz, 1);
+                column->setBlock(lx, h, lz, 3);
+            }
+        }
+        for(int i = 0; i < 200; i++){
+            const int x = rng() % TERRAIN_XZ, y = rng() % 80 - 40, z = rng() % TERRAIN_XZ;
+            for(int dy = -2; dy <= 2; dy++){
+                for(int dz = -3; dz <= 3; dz++){
+                    for(int dx = -3; dx <= 3; dx++){
+                        world.setBlock(x + dx, y + dy, z + dz, 0);
+                    }
+                }
+            }
+        }
+
+        // Sala de la explosión
+        for(int y = 4; y <= 16; y++){
+            for(int z = 122; z <= 134; z++){
+                for(int x = 122; x <= 134; x++){
+                    world.setBlock(x, y, z, 0);
+                }
+            }
+        }
+
+        std::uniform_real_distribution<float> unit(-1.0f, 1.0f);
+        std::uniform_real_distribution<float> position(16.0f, TERRAIN_XZ - 16.0f);
+        std::vector<Ray> rays(RAY_COUNT);
+
+        for(Ray& ray : rays){
+            ray = Ray{{position(rng), 54.6f, position(rng)}, {unit(rng), -0.3f - std::fabs(unit(rng)), unit(rng)}, 8.0f};
+        }
+        measure(world, "pick", rays);
+
+        for(Ray& ray : rays){
+            ray = Ray{{position(rng), 60.0f + 20.0f * std::fabs(unit(rng)), position(rng)}, {unit(rng), 0.05f * unit(rng), unit(rng)}, 128.0f};
+        }
+        measure(world, "sight", rays);
+
+        for(Ray& ray : rays){
+            ray = Ray{{128.5f, 10.5f, 128.5f}, {unit(rng), unit(rng), unit(rng)}, 12.0f};
+        }
+        measure(world, "explosion", rays);
+    }
+}
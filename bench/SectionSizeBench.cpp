@@ -0,0 +1,193 @@
+#include "Bench.h"
+#include "world/World.h"
+#include "world/PaddedSnapshot.h"
+#include "world/BlockRegistry.h"
+#include <vector>
+#include <random>
+#include <cmath>
+
+namespace AbyssBench {
+
+    using namespace AbyssCore;
+
+    // Región fija en bloques, independiente del tamaño de sección, para comparar compilaciones
+    static constexpr int REGION_XZ = 128;
+    static constexpr int REGION_MIN_Y = -64;
+    static constexpr int REGION_MAX_Y = 128;   // Exclusivo
+
+    /**
+     * @brief Terreno ondulado con menas y cuevas esféricas, escrito fila a fila con setRow.
+     */
+    static void generateRegion(World& world){
+        const BlockRegistry& registry = BlockRegistry::getInstance();
+        const BlockID STONE = registry.getBaseState(BLOCK_STONE), DIRT = registry.getBaseState(BLOCK_DIRT);
+        const BlockID GRASS = registry.getBaseState(BLOCK_GRASS), COAL = registry.getBaseState(BLOCK_COAL);
+        std::vector<int> heights(REGION_XZ * REGION_XZ);
+        for(int z = 0; z < REGION_XZ; z++){
+            for(int x = 0; x < REGION_XZ; x++){
+                heights[z * REGION_XZ + x] = 40 + static_cast<int>(12.0 * std::sin(x * 0.09) * std::cos(z * 0.07));
+            }
+        }
+        std::mt19937 rng(7);
+        std::vector<BlockID> row(CHUNK_SECTION_SIZE);
+        for(int cz = 0; cz < REGION_XZ / CHUNK_SECTION_SIZE; cz++){
+            for(int cx = 0; cx < REGION_XZ / CHUNK_SECTION_SIZE; cx++){
+                ChunkColumn* column = world.getOrCreateColumn(cx, cz);
+                for(int y = REGION_MIN_Y; y < REGION_MAX_Y; y++){
+                    for(int lz = 0; lz < CHUNK_SECTION_SIZE; lz++){
+                        const int z = cz * CHUNK_SECTION_SIZE + lz;
+                        for(int lx = 0; lx < CHUNK_SECTION_SIZE; lx++){
+                            const int h = heights[z * REGION_XZ + cx * CHUNK_SECTION_SIZE + lx];
+                            BlockID block = (y > h) ? 0 : (y == h) ? GRASS : (y > h - 4) ? DIRT : STONE;
+                            if(block == STONE && rng() % 64 == 0){
+                                block = COAL;
+                            }
+                            row[lx] = block;
+                        }
+                        column->setRow(0, y, lz, row.data(), CHUNK_SECTION_SIZE);
+                    }
+                }
+            }
+        }
+        // Cuevas: esferas de aire bajo tierra
+        for(int i = 0; i < 40; i++){
+            const int cx = rng() % REGION_XZ, cy = REGION_MIN_Y + 8 + rng() % 64, cz = rng() % REGION_XZ;
+            const int r = 3 + rng() % 4;
+            for(int y = cy - r; y <= cy + r; y++){
+                for(int z = cz - r; z <= cz + r; z++){
+                    for(int x = cx - r; x <= cx + r; x++){
+                        if(x >= 0 && z >= 0 && x < REGION_XZ && z < REGION_XZ &&
+                           (x - cx) * (x - cx) + (y - cy) * (y - cy) + (z - cz) * (z - cz) <= r * r){
+                            world.setBlock(x, y, z, 0);
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Mide mallado, luz y guardado por sección con el tamaño de sección de esta compilación.
+     *
+     * - mesh: copia acolchada (PaddedSnapshot) y conteo de caras visibles, como un mallador simple.
+     * - light: relleno BFS del aire conectado a la capa superior dentro de la copia acolchada.
+     * - save: snapshot y recodificación a paleta (lo que escribiría un guardado) y bytes resultantes.
+     *
+     * Todo se expresa por bloque para poder comparar ejecutables compilados con distinto
+     * ABYSS_SECTION_SIZE_LOG2 (ver opción ABYSS_BENCH_SECTION_SIZES).
+     */
+    void runSectionSizeBench(){
+        BlockRegistry::getInstance().init([](const std::string&){ return 0; });
+        World world;
+        generateRegion(world);
+
+        const std::string size = std::to_string(CHUNK_SECTION_SIZE) + "^3";
+        const int chunks = REGION_XZ / CHUNK_SECTION_SIZE;
+        const int minSection = REGION_MIN_Y >> CHUNK_SECTION_SIZE_LOG2;
+        const int maxSection = (REGION_MAX_Y - 1) >> CHUNK_SECTION_SIZE_LOG2;
+        const int sections = chunks * chunks * (maxSection - minSection + 1);
+        const double blocks = static_cast<double>(sections) * CHUNK_SECTION_VOLUME;
+        report("section_size", "section size " + size + ", sections", sections, "");
+
+        // Mallado
+        PaddedSnapshot snapshot(1);
+        const int dim = snapshot.getDim();
+        const int strides[6] = {-1, 1, -dim * dim, dim * dim, -dim, dim};
+        uint64_t faces = 0;
+        Clock::time_point start = Clock::now();
+        for(int cz = 0; cz < chunks; cz++){
+            for(int cx = 0; cx < chunks; cx++){
+                for(int sy = minSection; sy <= maxSection; sy++){
+                    snapshot.extract(world, cx, sy, cz);
+                    const BlockID* data = snapshot.data();
+                    for(int y = 0; y < CHUNK_SECTION_SIZE; y++){
+                        for(int z = 0; z < CHUNK_SECTION_SIZE; z++){
+                            int i = snapshot.index(0, y, z);
+                            for(int x = 0; x < CHUNK_SECTION_SIZE; x++, i++){
+                                if(data[i] == 0){
+                                    continue;
+                                }
+                                for(int stride : strides){
+                                    faces += (data[i + stride] == 0);
+                                }
+                            }
+                        }
+                    }
+                }
+            }
+        }
+        double seconds = secondsSince(start);
+        report("section_size", "mesh " + size, blocks / seconds / 1e6, "Mblocks/s");
+        doNotOptimize(faces);
+
+        // Luz: BFS del aire alcanzable desde la capa superior de la copia
+        std::vector<uint8_t> lit(static_cast<std::size_t>(dim) * dim * dim);
+        std::vector<int> queue;
+        uint64_t litCount = 0;
+        start = Clock::now();
+        for(int cz = 0; cz < chunks; cz++){
+            for(int cx = 0; cx < chunks; cx++){
+                for(int sy = minSection; sy <= maxSection; sy++){
+                    snapshot.extract(world, cx, sy, cz);
+                    const BlockID* data = snapshot.data();
+                    std::fill(lit.begin(), lit.end(), 0);
+                    queue.clear();
+                    for(int z = 0; z < dim; z++){
+                        for(int x = 0; x < dim; x++){
+                            const int i = (dim - 1) * dim * dim + z * dim + x;
+                            if(data[i] == 0){
+                                lit[i] = 1;
+                                queue.push_back(i);
+                            }
+                        }
+                    }
+                    for(std::size_t head = 0; head < queue.size(); head++){
+                        const int i = queue[head];
+                        const int y = i / (dim * dim), z = (i / dim) % dim, x = i % dim;
+                        for(int face = 0; face < 6; face++){
+                            const int axis = (face < 2) ? x : (face < 4) ? y : z;
+                            if((face & 1) ? axis == dim - 1 : axis == 0){
+                                continue;
+                            }
+                            const int n = i + strides[face];
+                            if(!lit[n] && data[n] == 0){
+                                lit[n] = 1;
+                                queue.push_back(n);
+                            }
+                        }
+                    }
+                    litCount += queue.size();
+                }
+            }
+        }
+        seconds = secondsSince(start);
+        report("section_size", "light " + size, blocks / seconds / 1e6, "Mblocks/s");
+        doNotOptimize(litCount);
+
+        // Guardado
+        std::vector<BlockID> dense(CHUNK_SECTION_VOLUME);
+        std::size_t savedBytes = 0;
+        start = Clock::now();
+        {
+            EpochGuard guard;
+            for(int cz = 0; cz < chunks; cz++){
+                for(int cx = 0; cx < chunks; cx++){
+                    const ChunkColumn* column = world.getColumn(cx, cz);
+                    for(int sy = minSection; sy <= maxSection; sy++){
+                        const ChunkSection* section = column->findSection(sy);
+                        if(section == nullptr){
+                            continue;
+                        }
+                        section->snapshot(dense.data());
+                        PalettedContainer encoded(CHUNK_SECTION_VOLUME);
+                        encoded.encode(dense.data());
+                        savedBytes += encoded.getMemoryUsage();
+                    }
+                }
+            }
+        }
+        seconds = secondsSince(start);
+        report("section_size", "save " + size, blocks / seconds / 1e6, "Mblocks/s");
+        report("section_size", "save bytes per 1000 blocks " + size, savedBytes * 1000.0 / blocks, "B");
+    }
+}
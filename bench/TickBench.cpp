@@ -0,0 +1,280 @@
+#include "Bench.h"
+#include "world/RandomTick.h"
+#include "world/ScheduledTick.h"
+#include <vector>
+#include <queue>
+#include <unordered_set>
+#include <random>
+#include <cmath>
+
+namespace AbyssBench {
+
+    using namespace AbyssCore;
+
+    static constexpr int COLUMNS_PER_AXIS = 32;
+    static constexpr int MIN_Y = -64;
+    static constexpr int MAX_Y = 192;
+    static constexpr int TICKS = 200;
+    static constexpr int SCHEDULED = 1000000;
+    static constexpr int MAX_DELAY = 100;
+    static constexpr int UNLOADS = 8;
+
+    /**
+     * @brief Referencia: muestrea todas las secciones de todas las columnas con mt19937 y World::getBlock.
+     */
+    static int naiveRandomTick(const World& world, std::mt19937& rng, int draws, int& sampled){
+        const BlockRegistry& registry = BlockRegistry::getInstance();
+        int ticked = 0;
+        world.forEachColumn([&](const ChunkColumn* column){
+            for(int sectionY = column->getMinSectionY(); sectionY <= column->getMaxSectionY(); sectionY++){
+                sampled++;
+                for(int i = 0; i < draws; i++){
+                    const int x = column->x * CHUNK_SECTION_SIZE + static_cast<int>(rng() % CHUNK_SECTION_SIZE);
+                    const int y = sectionY * CHUNK_SECTION_SIZE + static_cast<int>(rng() % CHUNK_SECTION_SIZE);
+                    const int z = column->z * CHUNK_SECTION_SIZE + static_cast<int>(rng() % CHUNK_SECTION_SIZE);
+                    ticked += registry.ticksRandomly(world.getBlock(x, y, z));
+                }
+            }
+        });
+        return ticked;
+    }
+
+    /**
+     * @brief Coste de un tick aleatorio sobre 32x32 columnas de 16 secciones (hasta Y = 192).
+     *
+     * Solo la capa de hierba de la superficie tiene bloques con tick aleatorio: la referencia
+     * muestrea todas las secciones, RandomTicker solo las que tienen alguno.
+     */
+    void runRandomTickBench(){
+        BlockRegistry::getInstance().init([](const std::string&){ return 0; });
+        const BlockRegistry& registry = BlockRegistry::getInstance();
+        const BlockID stone = registry.getBaseState(BLOCK_STONE);
+        const BlockID dirt = registry.getBaseState(BLOCK_DIRT);
+        const BlockID grass = registry.getBaseState(BLOCK_GRASS);
+        const BlockID water = registry.getBaseState(BLOCK_WATER);
+        const int size = COLUMNS_PER_AXIS * CHUNK_SECTION_SIZE;
+
+        World world;
+        for(int z = 0; z < size; z++){
+            for(int x = 0; x < size; x++){
+                const int h = 60 + static_cast<int>(12.0 * std::sin(x * 0.03) * std::cos(z * 0.05));
+                ChunkColumn* column = world.getOrCreateColumn(World::toChunkCoord(x), World::toChunkCoord(z));
+                const int lx = World::toLocalCoord(x), lz = World::toLocalCoord(z);
+                column->fillBox(lx, MIN_Y, lz, lx, h - 4, lz, stone);
+                column->fillBox(lx, h - 3, lz, lx, h - 1, lz, dirt);
+                // Las zonas bajas quedan bajo el agua
+                if(h < 56){
+                    column->fillBox(lx, h, lz, lx, 55, lz, water);
+                }else{
+                    column->setBlock(lx, h, lz, grass);
+                }
+            }
+        }
+        // Secciones vacías hasta MAX_Y, como en una columna recién cargada
+        for(int cz = 0; cz < COLUMNS_PER_AXIS; cz++){
+            for(int cx = 0; cx < COLUMNS_PER_AXIS; cx++){
+                for(int sectionY = 0; sectionY < MAX_Y / CHUNK_SECTION_SIZE; sectionY++){
+                    world.getOrCreateColumn(cx, cz)->getSection(sectionY);
+                }
+            }
+        }
+
+        int sections = 0, tickableSections = 0, tickableBlocks = 0;
+        world.forEachColumn([&](const ChunkColumn* column){
+            for(int sectionY = column->getMinSectionY(); sectionY <= column->getMaxSectionY(); sectionY++){
+                sections++;
+                tickableSections += (column->findSection(sectionY)->getTickableCount() != 0);
+                tickableBlocks += column->findSection(sectionY)->getTickableCount();
+            }
+        });
+        report("random_tick", "sections with tickable blocks", 100.0 * tickableSections / sections, "%");
+
+        std::mt19937 rng(3);
+        int sampled = 0, ticked = 0;
+        Clock::time_point start = Clock::now();
+        int remainder = 0;
+        for(int i = 0; i < TICKS; i++){
+            // Mismo ritmo por bloque que RandomTicker, con el resto arrastrado entre ticks
+            remainder += RANDOM_TICKS_PER_VOLUME * CHUNK_SECTION_VOLUME;
+            ticked += naiveRandomTick(world, rng, remainder / RANDOM_TICK_VOLUME, sampled);
+            remainder %= RANDOM_TICK_VOLUME;
+        }
+        report("random_tick", "every section, mt19937 + getBlock", secondsSince(start) * 1e6 / TICKS, "us/tick");
+        report("random_tick", "  blocks ticked", double(ticked) / TICKS, "per tick");
+
+        RandomTicker ticker(world);
+        ticked = 0;
+        sampled = 0;
+        start = Clock::now();
+        for(int i = 0; i < TICKS; i++){
+            ticker.tick();
+            ticked += ticker.getBlocksTicked();
+            sampled += ticker.getSectionsSampled();
+        }
+        report("random_tick", "RandomTicker", secondsSince(start) * 1e6 / TICKS, "us/tick");
+        report("random_tick", "  sections sampled", double(sampled) / TICKS, "per tick");
+        report("random_tick", "  blocks ticked", double(ticked) / TICKS, "per tick");
+        // Debe salir ~RANDOM_TICKS_PER_VOLUME con cualquier tamaño de sección
+        report("random_tick", "  ticks per tickable block x 4096", double(ticked) / TICKS / tickableBlocks * RANDOM_TICK_VOLUME, "per tick");
+
+        std::vector<uint32_t> draws(1 << 20);
+        TickRandom random(7);
+        start = Clock::now();
+        for(int i = 0; i < 16; i++){
+            random.generate(draws.data(), static_cast<int>(draws.size()));
+            doNotOptimize(draws[i]);
+        }
+        report("random_tick", "TickRandom", 16.0 * draws.size() / secondsSince(start) / 1e6, "M/s");
+        start = Clock::now();
+        uint32_t sum = 0;
+        for(int i = 0; i < 16 * (1 << 20); i++){
+            sum += rng();
+        }
+        doNotOptimize(sum);
+        report("random_tick", "mt19937", 16.0 * draws.size() / secondsSince(start) / 1e6, "M/s");
+    }
+
+    /**
+     * @brief Referencia: una única cola de prioridad global con un conjunto global de duplicados.
+     */
+    struct GlobalTickQueue {
+        struct Entry {
+            uint64_t due;
+            uint64_t sequence;
+            int x, y, z;
+            BlockTypeID type;
+            bool operator>(const Entry& other) const {
+                return due > other.due || (due == other.due && sequence > other.sequence);
+            }
+        };
+        static uint64_t key(int x, int y, int z, BlockTypeID type){
+            return (uint64_t(uint32_t(y)) << 40) ^ (uint64_t(uint32_t(x)) << 20) ^ uint64_t(uint32_t(z)) ^ (uint64_t(type) << 56);
+        }
+
+        std::priority_queue<Entry, std::vector<Entry>, std::greater<Entry>> queue;
+        std::unordered_set<uint64_t> pending;
+        uint64_t currentTick = 0, sequence = 0;
+
+        bool schedule(int x, int y, int z, BlockTypeID type, int delay){
+            if(!pending.insert(key(x, y, z, type)).second){
+                return false;
+            }
+            queue.push({currentTick + delay, sequence++, x, y, z, type});
+            return true;
+        }
+        int tick(){
+            currentTick++;
+            int executed = 0;
+            while(!queue.empty() && queue.top().due <= currentTick){
+                const Entry entry = queue.top();
+                queue.pop();
+                pending.erase(key(entry.x, entry.y, entry.z, entry.type));
+                executed++;
+            }
+            return executed;
+        }
+        // Descargar una columna obliga a reconstruir la cola sin sus entradas
+        void dropColumn(int chunkX, int chunkZ){
+            std::vector<Entry> kept;
+            kept.reserve(queue.size());
+            while(!queue.empty()){
+                const Entry& entry = queue.top();
+                if(World::toChunkCoord(entry.x) == chunkX && World::toChunkCoord(entry.z) == chunkZ){
+                    pending.erase(key(entry.x, entry.y, entry.z, entry.type));
+                }else{
+                    kept.push_back(entry);
+                }
+                queue.pop();
+            }
+            queue = decltype(queue)(std::greater<Entry>(), std::move(kept));
+        }
+    };
+
+    /**
+     * @brief Ticks programados: 1M ticks con retraso de 1 a 100 sobre 32x32 columnas.
+     *
+     * Compara TickScheduler con una cola de prioridad global: programar (con duplicados), vaciar
+     * tick a tick y descargar columnas con ticks pendientes.
+     */
+    void runScheduledTickBench(){
+        const int size = COLUMNS_PER_AXIS * CHUNK_SECTION_SIZE;
+        World world;
+        for(int cz = 0; cz < COLUMNS_PER_AXIS; cz++){
+            for(int cx = 0; cx < COLUMNS_PER_AXIS; cx++){
+                world.getOrCreateColumn(cx, cz)->getSection(0);
+            }
+        }
+        std::mt19937 rng(11);
+        struct Request { int x, y, z, delay; BlockTypeID type; };
+        std::vector<Request> requests(SCHEDULED);
+        for(Request& request : requests){
+            // Y en un rango corto para que haya duplicados, como los fluidos que se reprograman
+            request = {static_cast<int>(rng() % size), static_cast<int>(rng() % 64), static_cast<int>(rng() % size),
+                       1 + static_cast<int>(rng() % MAX_DELAY), static_cast<BlockTypeID>(BLOCK_WATER + rng() % 2)};
+        }
+
+        GlobalTickQueue global;
+        int accepted = 0;
+        Clock::time_point start = Clock::now();
+        for(const Request& request : requests){
+            accepted += global.schedule(request.x, request.y, request.z, request.type, request.delay);
+        }
+        report("scheduled_tick", "global queue schedule", secondsSince(start) * 1e9 / SCHEDULED, "ns/tick");
+        start = Clock::now();
+        int executed = 0;
+        for(int i = 0; i < MAX_DELAY; i++){
+            executed += global.tick();
+        }
+        report("scheduled_tick", "global queue execute", secondsSince(start) * 1e9 / executed, "ns/tick");
+
+        TickScheduler scheduler(world);
+        scheduler.setBudget(INT32_MAX);
+        accepted = 0;
+        start = Clock::now();
+        for(const Request& request : requests){
+            accepted += scheduler.schedule(request.x, request.y, request.z, request.type, request.delay);
+        }
+        report("scheduled_tick", "TickScheduler schedule", secondsSince(start) * 1e9 / SCHEDULED, "ns/tick");
+        report("scheduled_tick", "  accepted (not duplicates)", accepted, "ticks");
+        start = Clock::now();
+        executed = 0;
+        for(int i = 0; i < MAX_DELAY; i++){
+            scheduler.tick();
+            executed += scheduler.getExecutedCount();
+        }
+        report("scheduled_tick", "TickScheduler execute", secondsSince(start) * 1e9 / executed, "ns/tick");
+
+        // Descarga de columnas con todos sus ticks pendientes (la cola global se reconstruye entera cada vez)
+        for(const Request& request : requests){
+            global.schedule(request.x, request.y, request.z, request.type, request.delay);
+            scheduler.schedule(request.x, request.y, request.z, request.type, request.delay);
+        }
+        start = Clock::now();
+        for(int i = 0; i < UNLOADS; i++){
+            global.dropColumn(i % COLUMNS_PER_AXIS, i / COLUMNS_PER_AXIS);
+        }
+        report("scheduled_tick", "global queue unload column", secondsSince(start) * 1e6 / UNLOADS, "us/column");
+        start = Clock::now();
+        for(int i = 0; i < UNLOADS; i++){
+            scheduler.dropColumn(i % COLUMNS_PER_AXIS, i / COLUMNS_PER_AXIS);
+        }
+        report("scheduled_tick", "TickScheduler unload column", secondsSince(start) * 1e6 / UNLOADS, "us/column");
+
+        // Todo lo que queda vence a la vez: el presupuesto lo reparte en varios ticks
+        scheduler.setBudget(SCHEDULED_TICK_BUDGET);
+        while(scheduler.getPendingCount() != 0){
+            scheduler.tick();
+        }
+        for(const Request& request : requests){
+            scheduler.schedule(request.x, request.y, request.z, request.type, 1);
+        }
+        int ticks = 0, peak = 0;
+        while(scheduler.getPendingCount() != 0){
+            scheduler.tick();
+            peak = std::max(peak, scheduler.getExecutedCount());
+            ticks++;
+        }
+        report("scheduled_tick", "burst with budget: ticks to drain", ticks, "ticks");
+        report("scheduled_tick", "burst with budget: max per tick", peak, "ticks");
+    }
+}
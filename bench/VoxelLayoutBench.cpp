@@ -0,0 +1,144 @@
+#include "Bench.h"
+#include "world/ChunkSection.h"
+#include <vector>
+#include <memory>
+#include <random>
+
+namespace AbyssBench {
+
+    using namespace AbyssCore;
+
+    struct LinearLayout {
+        static constexpr const char* NAME = "linear";
+        static int index(int x, int y, int z){ return sectionIndex(x, y, z); }
+    };
+
+    struct MortonLayout {
+        static constexpr const char* NAME = "morton";
+        static int index(int x, int y, int z){ return Morton::encode(x, y, z); }
+    };
+
+    // Secciones suficientes para que los contenedores no quepan en L2 (~2 KB cada uno a 4 bits)
+    static constexpr int SECTION_COUNT = 1024;
+    static constexpr int PASSES = 4;
+
+    /**
+     * @brief Contenido de prueba: estratos con menas y huecos, 8 tipos de bloque (paleta de 4 bits).
+     */
+    static BlockID sampleBlock(std::mt19937& rng, int y){
+        if(rng() % 8 == 0){
+            return 0;
+        }
+        if(rng() % 16 == 0){
+            return static_cast<BlockID>(5 + rng() % 3);
+        }
+        return static_cast<BlockID>(1 + (y * 4) / CHUNK_SECTION_SIZE);
+    }
+
+    template <typename Layout>
+    static std::vector<std::unique_ptr<PalettedContainer>> buildSections(){
+        std::vector<std::unique_ptr<PalettedContainer>> sections;
+        std::mt19937 rng(7);
+        for(int s = 0; s < SECTION_COUNT; s++){
+            std::unique_ptr<PalettedContainer> container = std::make_unique<PalettedContainer>(CHUNK_SECTION_VOLUME);
+            for(int y = 0; y < CHUNK_SECTION_SIZE; y++){
+                for(int z = 0; z < CHUNK_SECTION_SIZE; z++){
+                    for(int x = 0; x < CHUNK_SECTION_SIZE; x++){
+                        container->set(Layout::index(x, y, z), sampleBlock(rng, y));
+                    }
+                }
+            }
+            sections.push_back(std::move(container));
+        }
+        return sections;
+    }
+
+    /**
+     * @brief Kernels de filas y de vecindario sobre el mismo contenido guardado con un layout dado.
+     *
+     * - rows: recorrido Y-Z-X contando bloques no aire (escaneo de mallado, heightmaps).
+     * - faces: 6 vecinos de cada vóxel interior (mallado de caras, propagación de luz).
+     * - box 3x3x3: consultas en puntos aleatorios de secciones aleatorias (colisiones de entidades).
+     */
+    template <typename Layout>
+    static void runLayout(){
+        const std::vector<std::unique_ptr<PalettedContainer>> sections = buildSections<Layout>();
+        const std::string name = Layout::NAME;
+        constexpr int N = CHUNK_SECTION_SIZE;
+        uint64_t sum = 0;
+
+        Clock::time_point start = Clock::now();
+        for(int pass = 0; pass < PASSES; pass++){
+            for(const std::unique_ptr<PalettedContainer>& section : sections){
+                for(int y = 0; y < N; y++){
+                    for(int z = 0; z < N; z++){
+                        for(int x = 0; x < N; x++){
+                            sum += (section->get(Layout::index(x, y, z)) != 0);
+                        }
+                    }
+                }
+            }
+        }
+        double reads = static_cast<double>(PASSES) * SECTION_COUNT * CHUNK_SECTION_VOLUME;
+        report("voxel_layout", "rows " + name, reads / secondsSince(start) / 1e6, "Mreads/s");
+
+        start = Clock::now();
+        for(int pass = 0; pass < PASSES; pass++){
+            for(const std::unique_ptr<PalettedContainer>& section : sections){
+                for(int y = 1; y < N - 1; y++){
+                    for(int z = 1; z < N - 1; z++){
+                        for(int x = 1; x < N - 1; x++){
+                            if(section->get(Layout::index(x, y, z)) == 0){
+                                continue;
+                            }
+                            sum += (section->get(Layout::index(x - 1, y, z)) == 0) + (section->get(Layout::index(x + 1, y, z)) == 0) +
+                                   (section->get(Layout::index(x, y - 1, z)) == 0) + (section->get(Layout::index(x, y + 1, z)) == 0) +
+                                   (section->get(Layout::index(x, y, z - 1)) == 0) + (section->get(Layout::index(x, y, z + 1)) == 0);
+                        }
+                    }
+                }
+            }
+        }
+        // Lecturas aproximadas: el centro siempre, los 6 vecinos solo si no es aire (7/8 de los vóxeles)
+        reads = static_cast<double>(PASSES) * SECTION_COUNT * (N - 2) * (N - 2) * (N - 2) * (1 + 6 * 7.0 / 8);
+        report("voxel_layout", "faces " + name, reads / secondsSince(start) / 1e6, "Mreads/s");
+
+        constexpr int QUERIES = 2000000;
+        std::mt19937 rng(11);
+        std::vector<int> queries(QUERIES * 4);
+        for(int i = 0; i < QUERIES; i++){
+            queries[i * 4 + 0] = rng() % SECTION_COUNT;
+            queries[i * 4 + 1] = 1 + rng() % (N - 2);
+            queries[i * 4 + 2] = 1 + rng() % (N - 2);
+            queries[i * 4 + 3] = 1 + rng() % (N - 2);
+        }
+        start = Clock::now();
+        for(int i = 0; i < QUERIES; i++){
+            const PalettedContainer& section = *sections[queries[i * 4]];
+            const int cx = queries[i * 4 + 1], cy = queries[i * 4 + 2], cz = queries[i * 4 + 3];
+            for(int y = cy - 1; y <= cy + 1; y++){
+                for(int z = cz - 1; z <= cz + 1; z++){
+                    for(int x = cx - 1; x <= cx + 1; x++){
+                        sum += (section.get(Layout::index(x, y, z)) != 0);
+                    }
+                }
+            }
+        }
+        reads = 27.0 * QUERIES;
+        report("voxel_layout", "box 3x3x3 " + name, reads / secondsSince(start) / 1e6, "Mreads/s");
+        doNotOptimize(sum);
+    }
+
+    /**
+     * @brief Compara el layout lineal Y-Z-X y el Morton sobre PalettedContainer, en el mismo binario.
+     *
+     * Mide el almacenamiento directamente (lo que lee ChunkSection::getBlock), así que no depende
+     * de ABYSS_MORTON_LAYOUT; para medir el motor completo con el otro layout ver ABYSS_BENCH_LAYOUTS.
+     */
+    void runVoxelLayoutBench(){
+        report("voxel_layout", std::string("build layout ") + (CHUNK_SECTION_MORTON ? "morton" : "linear") +
+               ", sections", SECTION_COUNT, "");
+        runLayout<LinearLayout>();
+        runLayout<MortonLayout>();
+    }
+}
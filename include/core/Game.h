@@ -8,6 +8,11 @@
 #include "Window.h"
 #include "render/Shader.h"
 #include "render/Tessellator.h"
+#include "world/World.h"
+#include "world/LightScheduler.h"
+#include "world/RandomTick.h"
+#include "world/ScheduledTick.h"
+#include "world/FluidSimulation.h"
 #include <iostream>
 
 namespace AbyssCore {
@@ -27,11 +32,28 @@ namespace AbyssCore {
             // --- Hilo de Física/Mundo
             void worldLoop();
 
+            // Handlers de RandomTicker por tipo de bloque
+            void registerRandomTicks();
+
+            // Diagnóstico: memoria por subsistema
+            void logMemoryUsage() const;
+
             // Render Assets
             std::unique_ptr<Shader> m_shader; // unique_ptr, para gestión automatica de memoria
 
             std::unique_ptr<Window> m_window;
 
+            // Mundo: columnas cargadas, compartido por todos los hilos
+            std::unique_ptr<World> m_world;
+            // Luz del mundo; la pide el hilo de lógica y la reparte entre sus trabajadores
+            std::unique_ptr<LightScheduler> m_lightScheduler;
+            // Ticks aleatorios de bloques (hierba); solo en el hilo de lógica
+            std::unique_ptr<RandomTicker> m_randomTicker;
+            // Ticks de bloque diferidos (fluidos, caídas); solo en el hilo de lógica
+            std::unique_ptr<TickScheduler> m_tickScheduler;
+            // Agua y lava; la avanza el hilo de lógica con sus propios trabajadores
+            std::unique_ptr<FluidSimulation> m_fluids;
+
             // Control de hilos
             std::atomic<bool> m_isRunning;
             std::thread m_logicThread;
@@ -4,6 +4,7 @@
 #include <glad/glad.h>
 #include <vector>
 #include <string>
+#include <cstdint>
 #include <unordered_map> // Estructura diccionario o hash
 
 
@@ -18,8 +19,11 @@ namespace AbyssCore {
             // Load de las texturas y generación de array de datos
             void loadTextures();
             
-            // Retorno de del indice de la capa segun un nombre
-            int getTextureLayer(const std::string& name);
+            // Retorno de del indice de la capa segun un nombre.
+            // Solo para resolver una vez al registrar bloques: por bloque o cara se usan las capas ya resueltas
+            int getTextureLayer(const std::string& name) const;
+            int getTextureCount() const { return static_cast<int>(m_textureNames.size()); }
+            const std::string& getTextureName(int layer) const { return m_textureNames[layer]; }
             
             // Inicio de la textura en el shader
             void bind();
@@ -27,7 +31,9 @@ namespace AbyssCore {
             TextureManager() = default;
 
             unsigned int m_textureID;
-            std::unordered_map<std::string,int> m_textureMap;
+            // Nombres internados al cargar: la capa del texture array es el handle
+            std::unordered_map<std::string,uint16_t> m_textureMap;
+            std::vector<std::string> m_textureNames;
 
             const int TEXTURE_WIDTH = 16;
             const int TEXTURE_HEIGHT = 16;
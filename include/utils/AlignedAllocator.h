@@ -0,0 +1,47 @@
+#ifndef ALIGNEDALLOCATOR_H
+#define ALIGNEDALLOCATOR_H
+#include <cstddef>
+#include <new>
+#include <vector>
+
+namespace AbyssCore {
+
+    constexpr std::size_t CACHE_LINE_SIZE = 64;
+
+    /**
+     * @class AlignedAllocator
+     * @brief Allocator para std::vector que alinea el buffer a 'Alignment' bytes (por defecto una línea de caché).
+     *
+     * Para tablas calientes de solo lectura: el primer elemento empieza en una línea propia
+     * y ninguna otra estructura comparte esa línea.
+     */
+    template <typename T, std::size_t Alignment = CACHE_LINE_SIZE>
+    class AlignedAllocator {
+        public:
+            using value_type = T;
+
+            template <typename U>
+            struct rebind { using other = AlignedAllocator<U, Alignment>; };
+
+            AlignedAllocator() = default;
+            template <typename U>
+            AlignedAllocator(const AlignedAllocator<U, Alignment>&) {}
+
+            T* allocate(std::size_t count){
+                return static_cast<T*>(::operator new(count * sizeof(T), std::align_val_t(Alignment)));
+            }
+            void deallocate(T* ptr, std::size_t){
+                ::operator delete(ptr, std::align_val_t(Alignment));
+            }
+
+            template <typename U>
+            bool operator==(const AlignedAllocator<U, Alignment>&) const { return true; }
+            template <typename U>
+            bool operator!=(const AlignedAllocator<U, Alignment>&) const { return false; }
+    };
+
+    template <typename T>
+    using AlignedVector = std::vector<T, AlignedAllocator<T>>;
+}
+
+#endif // ALIGNEDALLOCATOR_H
@@ -0,0 +1,69 @@
+#ifndef MEMORYSTATS_H
+#define MEMORYSTATS_H
+#include <atomic>
+#include <cstddef>
+
+namespace AbyssCore {
+
+    // Subsistemas cuya memoria se contabiliza por separado
+    enum MemoryCategory {
+        MEMORY_SECTIONS,    // ChunkSection + almacenamiento comprimido
+        MEMORY_COLUMNS,     // ChunkColumn, tablas de secciones, mapa de columnas
+        MEMORY_MESHES,      // Búferes de vértices (CPU y GPU)
+        MEMORY_TEXTURES,    // Texturas subidas a GPU (con mipmaps)
+        MEMORY_POOLS,       // Reservas de los allocators de bloques
+        MEMORY_CATEGORY_COUNT
+    };
+
+    // Foto de la memoria usada, en bytes por categoría
+    struct MemoryReport {
+        std::size_t bytes[MEMORY_CATEGORY_COUNT] = {};
+
+        std::size_t total() const {
+            std::size_t sum = 0;
+            for(std::size_t categoryBytes : bytes){
+                sum += categoryBytes;
+            }
+            return sum;
+        }
+    };
+
+    /**
+     * @class MemoryStats
+     * @brief Contadores globales de memoria por subsistema.
+     *
+     * Los subsistemas con reservas puntuales (texturas, mallas, pools) suman y restan aquí al
+     * reservar y liberar. El mundo cambia demasiado a menudo para llevar la cuenta en cada
+     * escritura, así que se mide bajo demanda con World::accountMemory() sobre el mismo informe.
+     *
+     * @note Thread-Safe: los contadores son atómicos relajados.
+     */
+    class MemoryStats {
+        public:
+            static MemoryStats& getInstance() {
+                static MemoryStats instance;
+                return instance;
+            }
+
+            void add(MemoryCategory category, std::size_t bytes) {
+                m_bytes[category].fetch_add(bytes, std::memory_order_relaxed);
+            }
+            void remove(MemoryCategory category, std::size_t bytes) {
+                m_bytes[category].fetch_sub(bytes, std::memory_order_relaxed);
+            }
+            std::size_t get(MemoryCategory category) const {
+                return m_bytes[category].load(std::memory_order_relaxed);
+            }
+
+            // Informe con los contadores registrados (sin el mundo)
+            MemoryReport collect() const;
+            static const char* categoryName(MemoryCategory category);
+
+        private:
+            MemoryStats();
+
+            std::atomic<std::size_t> m_bytes[MEMORY_CATEGORY_COUNT];
+    };
+}
+
+#endif // MEMORYSTATS_H
@@ -0,0 +1,93 @@
+#ifndef BLOCKCURSOR_H
+#define BLOCKCURSOR_H
+#include "World.h"
+
+namespace AbyssCore {
+
+    // Desplazamientos de las 6 caras: -X, +X, -Y, +Y, -Z, +Z
+    constexpr int FACE_OFFSETS[6][3] = {
+        {-1, 0, 0}, {1, 0, 0}, {0, -1, 0}, {0, 1, 0}, {0, 0, -1}, {0, 0, 1}
+    };
+
+    /**
+     * @class BlockCursor
+     * @brief Posición en el mundo con la columna, la sección y sus 26 secciones vecinas en caché.
+     *
+     * Moverse o leer vecinos dentro de la misma sección no resuelve nada: solo al cruzar un
+     * borde de 16 bloques se vuelve a consultar la columna o el mundo. Las secciones vecinas
+     * se resuelven bajo demanda y se recuerdan hasta que el cursor cambia de sección.
+     *
+     * @note Pensado para kernels de vida corta (mallas, luz, física) en un solo hilo. Una sección
+     *       creada después de resolverla se sigue viendo como aire hasta el siguiente cambio de sección.
+     *       Mantiene un EpochGuard durante toda su vida, así que sus punteros en caché no se liberan;
+     *       no conviene guardarlo más allá de un trabajo porque retrasa la reclamación.
+     */
+    class BlockCursor {
+        public:
+            explicit BlockCursor(const World& world);
+            BlockCursor(const World& world, int x, int y, int z);
+
+            void moveTo(int x, int y, int z);
+            void move(int dx, int dy, int dz){
+                const int lx = m_localX + dx;
+                const int ly = m_localY + dy;
+                const int lz = m_localZ + dz;
+                m_x += dx;
+                m_y += dy;
+                m_z += dz;
+                if(((lx | ly | lz) & ~CHUNK_SECTION_MASK) == 0){
+                    m_localX = lx;
+                    m_localY = ly;
+                    m_localZ = lz;
+                    return;
+                }
+                resolve();
+            }
+
+            // Bloque en la posición actual
+            BlockID get() const {
+                return (m_section != nullptr) ? m_section->getBlock(m_localX, m_localY, m_localZ) : 0;
+            }
+            // Bloque desplazado sin mover el cursor
+            BlockID getRelative(int dx, int dy, int dz) const {
+                const int lx = m_localX + dx;
+                const int ly = m_localY + dy;
+                const int lz = m_localZ + dz;
+                if(((lx | ly | lz) & ~CHUNK_SECTION_MASK) == 0){
+                    return (m_section != nullptr) ? m_section->getBlock(lx, ly, lz) : 0;
+                }
+                return getRelativeSlow(lx, ly, lz);
+            }
+
+            // Vecinos por cara en el orden de FACE_OFFSETS
+            void getFaceNeighbors(BlockID out[6]) const;
+            // Los 26 vecinos del cubo 3x3x3 sin el centro, recorridos en Y, Z, X de -1 a +1
+            void getNeighbors26(BlockID out[26]) const;
+
+            int getX() const { return m_x; }
+            int getY() const { return m_y; }
+            int getZ() const { return m_z; }
+            const ChunkColumn* getColumn() const { return m_column; }
+            const ChunkSection* getSection() const { return m_section; }
+
+        private:
+            void resolve();
+            BlockID getRelativeSlow(int lx, int ly, int lz) const;
+            const ChunkSection* neighborSection(int sx, int sy, int sz) const;
+
+            // Primero: debe estar activo antes de resolver cualquier puntero
+            EpochGuard m_guard;
+            const World& m_world;
+            int m_x, m_y, m_z;
+            int m_localX, m_localY, m_localZ;
+            int m_chunkX, m_chunkZ, m_sectionY;
+            const ChunkColumn* m_column;
+            const ChunkSection* m_section;
+
+            // Secciones del cubo 3x3x3 alrededor de la actual, índice (sy+1)*9 + (sz+1)*3 + (sx+1)
+            mutable const ChunkSection* m_neighbors[27];
+            mutable uint32_t m_resolvedMask;
+    };
+}
+
+#endif // BLOCKCURSOR_H
@@ -2,29 +2,173 @@
 #define BLOCKREGISTRY_H
 #include <string>
 #include <vector>
+#include <array>
+#include <functional>
+#include <initializer_list>
+#include <utility>
 #include "BlockState.h"
+#include "utils/AlignedAllocator.h"
 
 namespace AbyssCore {
 
+    // Tipos registrados por init(), en orden de registro
+    enum BlockTypes : BlockTypeID {
+        BLOCK_AIR,
+        BLOCK_STONE,
+        BLOCK_DIRT,
+        BLOCK_GRASS,
+        BLOCK_LOG,
+        BLOCK_LEAVES,
+        BLOCK_COAL,
+        BLOCK_IRON,
+        BLOCK_WATER,
+        BLOCK_LAMP,
+        BLOCK_LAVA,
+        BLOCK_TYPE_COUNT
+    };
+
+    // Caras en el orden de FACE_OFFSETS: -X, +X, -Y (abajo), +Y (arriba), -Z, +Z
+    enum BlockFace {
+        FACE_NEG_X,
+        FACE_POS_X,
+        FACE_NEG_Y,
+        FACE_POS_Y,
+        FACE_NEG_Z,
+        FACE_POS_Z,
+        FACE_COUNT
+    };
+
+    // Formas de colisión; el índice se guarda por estado en la tabla de colisiones
+    enum CollisionShape : uint8_t {
+        SHAPE_EMPTY,        // Aire, fluidos
+        SHAPE_FULL_CUBE,
+        SHAPE_COUNT
+    };
+
+    // Luz: 0 = no atenúa, 15 = bloquea por completo
+    constexpr uint8_t LIGHT_MAX = 15;
+
+    /**
+     * @struct BlockType
+     * @brief Definición de un tipo al registrarlo y registro frío (nombre, propiedades) una vez registrado.
+     *
+     * Los campos que se consultan por bloque se copian a las tablas por estado de BlockRegistry.
+     */
     struct BlockType {
+        BlockType(std::string name, int textureTop, int textureSide, int textureBottom, bool isTransparent,
+                  uint8_t lightOpacity = LIGHT_MAX, uint8_t lightEmission = 0,
+                  CollisionShape collision = SHAPE_FULL_CUBE, bool ticksRandomly = false)
+        : name(std::move(name)),
+          textureTop(textureTop),
+          textureSide(textureSide),
+          textureBottom(textureBottom),
+          isTransparent(isTransparent),
+          lightOpacity(lightOpacity),
+          lightEmission(lightEmission),
+          collision(collision),
+          ticksRandomly(ticksRandomly) {}
+
         std::string name;
         int textureTop;
         int textureSide;
         int textureBottom;
         bool isTransparent; // Optimización de renderizado para hojas y cristal
+        uint8_t lightOpacity;
+        uint8_t lightEmission;
+        CollisionShape collision;
+        bool ticksRandomly;             // Recibe ticks aleatorios (hierba que se extiende o se apaga)
+
+        // Los rellena BlockRegistry al registrar el tipo
+        std::vector<BlockProperty> properties;
+        BlockID baseState = 0;
+        uint32_t stateCount = 1;
     };
 
+    // Traduce un nombre de textura a su capa en el texture array (lo aporta el render)
+    using TextureResolver = std::function<int(const std::string&)>;
+
+    /**
+     * @class BlockRegistry
+     * @brief Tipos de bloque y tablas planas por ID de estado para las consultas calientes.
+     *
+     * Cada atributo que leen mallas, luz o físicas vive en su propio array (structure of arrays)
+     * alineado a línea de caché e indexado directamente por estado: una consulta es una sola carga
+     * de 1 o 2 bytes. Nombres y propiedades quedan en m_blocks, que solo se usa al registrar o depurar.
+     *
+     * @note Los estados fuera de rango (registro sin iniciar, datos corruptos) se tratan como
+     *       opacos y sólidos salvo el 0, que es aire.
+     */
     class BlockRegistry {
         public:
             static BlockRegistry& getInstance(){
                 static BlockRegistry i;
                 return i;
             } 
-            void init();
-            const BlockType& getBlock(BlockID id) const;
+            // El registro no depende de OpenGL: quien lo inicia decide cómo resolver texturas
+            void init(const TextureResolver& textureLayer);
+            // Añade un tipo con sus propiedades y le asigna el siguiente rango de estados. Devuelve su baseState
+            BlockID registerBlock(BlockType type, std::initializer_list<BlockProperty> properties = {});
+
+            // Definición del tipo al que pertenece un estado (frío: nombre, propiedades)
+            const BlockType& getBlock(BlockID state) const;
+            const BlockType& getType(BlockTypeID type) const { return m_blocks[type]; }
+            const std::string& getName(BlockID state) const { return getBlock(state).name; }
+            BlockTypeID getTypeId(BlockID state) const {
+                return (state < m_stateTypes.size()) ? m_stateTypes[state] : static_cast<BlockTypeID>(BLOCK_AIR);
+            }
+            // Primer estado de un tipo: estado por defecto (todas las propiedades a 0)
+            BlockID getBaseState(BlockTypeID type) const { return m_blocks[type].baseState; }
+            // Lectura y cambio de una propiedad de un estado cualquiera
+            uint32_t getProperty(BlockID state, const BlockProperty& property) const {
+                return property.get(state - m_blocks[getTypeId(state)].baseState);
+            }
+            BlockID withProperty(BlockID state, const BlockProperty& property, uint32_t value) const {
+                const BlockID base = m_blocks[getTypeId(state)].baseState;
+                return base + property.with(state - base, value);
+            }
+
+            // Consultas calientes (alturas, luz, mallas, colisiones)
+            bool isTransparent(BlockID state) const {
+                return (state < m_stateCount) ? m_transparent[state] != 0 : (state == 0);
+            }
+            uint8_t getLightOpacity(BlockID state) const {
+                return (state < m_stateCount) ? m_lightOpacity[state] : (state == 0 ? 0 : LIGHT_MAX);
+            }
+            uint8_t getLightEmission(BlockID state) const {
+                return (state < m_stateCount) ? m_lightEmission[state] : 0;
+            }
+            CollisionShape getCollisionShape(BlockID state) const {
+                return (state < m_stateCount) ? m_collision[state] : (state == 0 ? SHAPE_EMPTY : SHAPE_FULL_CUBE);
+            }
+            bool ticksRandomly(BlockID state) const {
+                return (state < m_stateCount) && m_ticksRandomly[state] != 0;
+            }
+            // Capas de las 6 caras en orden BlockFace, ya orientadas según las propiedades del estado
+            const uint16_t* getFaceTextures(BlockID state) const {
+                static const std::array<uint16_t, FACE_COUNT> unknown{};
+                return (state < m_stateCount) ? m_faceTextures[state].data() : unknown.data();
+            }
+            int getFaceTexture(BlockID state, BlockFace face) const { return getFaceTextures(state)[face]; }
+
+            std::size_t size() const { return m_blocks.size(); }
+            // Estados totales: los IDs válidos van de 0 a getStateCount() - 1
+            std::size_t getStateCount() const { return m_stateCount; }
         private:
+            static std::array<uint16_t, FACE_COUNT> resolveFaces(const BlockType& type, uint32_t axis);
+
+            // Frío
             std::vector<BlockType> m_blocks;
+            std::vector<BlockTypeID> m_stateTypes;   // Estado -> tipo, precalculado al registrar
+
+            // Caliente: una entrada por estado
+            BlockID m_stateCount = 0;
+            AlignedVector<uint8_t> m_transparent;
+            AlignedVector<uint8_t> m_lightOpacity;
+            AlignedVector<uint8_t> m_lightEmission;
+            AlignedVector<CollisionShape> m_collision;
+            AlignedVector<uint8_t> m_ticksRandomly;
+            AlignedVector<std::array<uint16_t, FACE_COUNT>> m_faceTextures;  // [estado][cara], 12 bytes por estado
 
     };
 }
-#endif
\ No newline at end of file
+#endif
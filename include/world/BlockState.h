@@ -4,16 +4,54 @@
 
 namespace AbyssCore{
 
+    // ID de estado denso: cada tipo de bloque ocupa un rango [baseState, baseState + stateCount)
+    // y el desplazamiento dentro del rango empaqueta sus propiedades. Es lo que guardan las secciones
     using BlockID = uint32_t;
+    // Índice del tipo de bloque en BlockRegistry (Air, Stone, Log...)
+    using BlockTypeID = uint16_t;
+
+    /**
+     * @struct BlockProperty
+     * @brief Campo de bits de una propiedad dentro del desplazamiento de estado de su tipo.
+     *
+     * Las propiedades se declaran como constantes constexpr, así que get()/with() se reducen
+     * a shifts y máscaras. El número de valores es siempre potencia de 2.
+     */
+    struct BlockProperty {
+        const char* name;
+        uint8_t shift;
+        uint8_t bits;
+
+        constexpr uint32_t mask() const { return (1u << bits) - 1; }
+        constexpr int end() const { return shift + bits; }
+        constexpr uint32_t get(uint32_t offset) const { return (offset >> shift) & mask(); }
+        constexpr uint32_t with(uint32_t offset, uint32_t value) const {
+            return (offset & ~(mask() << shift)) | ((value & mask()) << shift);
+        }
+    };
+
+    // Propiedades comunes. Un tipo puede combinar varias siempre que sus bits no se solapen
+    namespace BlockProperties {
+        inline constexpr BlockProperty AXIS{"axis", 0, 2};        // Troncos: 0 = Y, 1 = X, 2 = Z
+        inline constexpr BlockProperty FACING{"facing", 0, 2};    // Norte, sur, oeste, este
+        inline constexpr BlockProperty AGE{"age", 0, 3};          // Cultivos: 0..7
+        inline constexpr BlockProperty LEVEL{"level", 0, 3};      // Fluidos: 0 = fuente, 1..7 distancia
+        inline constexpr BlockProperty FALLING{"falling", 3, 1};  // Fluido que cae desde arriba
+    }
 
     struct BlockState{
         BlockID id;
 
-
-        
+        // 'base' es el primer estado del tipo (BlockRegistry::getBaseState)
+        constexpr uint32_t get(BlockID base, const BlockProperty& property) const {
+            return property.get(id - base);
+        }
+        constexpr BlockState with(BlockID base, const BlockProperty& property, uint32_t value) const {
+            return BlockState{base + property.with(id - base, value)};
+        }
     };
-    
+
 
 }
 
-#endif // BLOCKSTATE_H
\ No newline at end of file
+#endif // BLOCKSTATE_H
@@ -0,0 +1,37 @@
+#ifndef CHANGEQUEUE_H
+#define CHANGEQUEUE_H
+#include <vector>
+#include <mutex>
+#include <cstddef>
+
+namespace AbyssCore {
+
+    // Sección que ha cambiado desde el último drenado
+    struct SectionChange {
+        int chunkX;
+        int sectionY;
+        int chunkZ;
+    };
+
+    /**
+     * @class ChangeQueue
+     * @brief Cola de notificaciones de secciones modificadas que se vacía una vez por tick.
+     *
+     * Las entradas se deduplican en origen con ChunkSection::claimNotification(), así que una
+     * sección aparece como mucho una vez por tick por muchas escrituras que reciba. Qué cambió
+     * exactamente se consulta después en sus máscaras de sub-cubos (ChunkSection::takeDirty).
+     */
+    class ChangeQueue {
+        public:
+            void push(const SectionChange& change);
+            // Mueve las entradas pendientes a 'out' (que se vacía antes) y deja la cola vacía
+            void drain(std::vector<SectionChange>& out);
+            std::size_t size() const;
+
+        private:
+            mutable std::mutex m_mutex;
+            std::vector<SectionChange> m_pending;
+    };
+}
+
+#endif // CHANGEQUEUE_H
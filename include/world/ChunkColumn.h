@@ -1,32 +1,136 @@
 #ifndef CHUNKCOLUMN_H
 #define CHUNKCOLUMN_H
-#include <unordered_map>
 #include <memory>
 #include <mutex>
+#include <atomic>
+#include <vector>
+#include <array>
+#include <climits>
 #include "ChunkSection.h"
+#include "ChangeQueue.h"
 
 namespace AbyssCore{
 
+    // Tipos de mapa de alturas que mantiene cada columna
+    enum HeightmapType {
+        HEIGHTMAP_SURFACE,  // Bloque no aire más alto
+        HEIGHTMAP_OPAQUE,   // Bloque opaco más alto (BlockType::isTransparent == false)
+        HEIGHTMAP_COUNT
+    };
+    // Altura de una columna (x,z) sin ningún bloque que cumpla el criterio
+    constexpr int HEIGHT_NONE = INT_MIN;
+
     class ChunkColumn {
         public:
             const int x, z;
+            // Distinto en cada columna creada (desde 1): una columna recargada, aunque el pool le dé la
+            // misma dirección, no se confunde con la anterior
+            const uint64_t loadId;
+
+            // 'changes' recibe una notificación por sección modificada (nullptr = sin notificaciones)
+            ChunkColumn(int x, int z, ChangeQueue* changes = nullptr);
+            ~ChunkColumn();
+
+            ChunkColumn(const ChunkColumn&) = delete;
+            ChunkColumn& operator=(const ChunkColumn&) = delete;
 
-            ChunkColumn(int x, int z);
+            // Igual que las secciones, las columnas salen de un SlabPool propio
+            static void* operator new(std::size_t size);
+            static void operator delete(void* ptr, std::size_t size);
+            static SlabPool& getPool();
 
             // Coordenadas mundiales relativas al chunk
             // Ejemplo: setBlock(5, 150, 5, Stone) -> Busca la sección Y=9
             void setBlock(int relX,int worldY, int relZ, BlockID block);
-            BlockID getBlock(int relX, int worldY, int relZ);
+            // Lectura sin lock. Requiere un EpochGuard activo (World::getBlock ya lo abre)
+            BlockID getBlock(int relX, int worldY, int relZ) const;
 
+            // Ediciones masivas: cada sección afectada se resuelve una vez y recibe un único lote.
+            // Cajas inclusivas; X/Z relativas al chunk [0, 15], Y mundial
+            void fillBox(int relX0, int worldY0, int relZ0, int relX1, int worldY1, int relZ1, BlockID block);
+            void fillLayer(int worldY, BlockID block);
+            void setRow(int relX0, int worldY, int relZ, const BlockID* blocks, int count);
+            int replaceInBox(int relX0, int worldY0, int relZ0, int relX1, int worldY1, int relZ1, BlockID from, BlockID to);
 
+            // Y mundial del bloque más alto según el tipo, o HEIGHT_NONE. Lectura sin lock
+            int getHeight(HeightmapType type, int relX, int relZ) const {
+                return m_heightmaps[type][(relZ << CHUNK_SECTION_SIZE_LOG2) | relX].load(std::memory_order_relaxed);
+            }
+            // Recalcula los mapas de alturas desde cero (columnas recién generadas o cargadas)
+            void rebuildHeightmaps();
+
+
+            // Devuelve la sección, creándola si no existe (toma el lock de escritura)
             ChunkSection* getSection(int yIndex);
+            // Búsqueda sin lock, nullptr si la sección no existe. Requiere un EpochGuard activo
+            ChunkSection* findSection(int yIndex) const {
+                const SectionTable* table = m_table.load(std::memory_order_acquire);
+                if(table == nullptr){
+                    return nullptr;
+                }
+                // El cast a unsigned hace que los índices por debajo de minY también caigan fuera
+                const unsigned offset = static_cast<unsigned>(yIndex - table->minY);
+                if(offset >= static_cast<unsigned>(table->capacity)){
+                    return nullptr;
+                }
+                return table->slots[offset].load(std::memory_order_acquire);
+            }
+
+            // Encola la sección en la cola de cambios sin que haya cambiado ningún bloque (p. ej. luz nueva)
+            void notifySection(ChunkSection* section);
 
+            // La luz ya se ha calculado (LightEngine::lightColumn). Antes, sus secciones tienen la luz por defecto
+            bool isLightReady() const { return m_lightReady.load(std::memory_order_acquire); }
+            void setLightReady() { m_lightReady.store(true, std::memory_order_release); }
 
-            // Es necesario Mutex para añadir secciones verticales
-            std::mutex m_columnMutex;
+            // Rango [min, max] de secciones existentes publicado para lectores. Vacío si min > max
+            int getMinSectionY() const { return m_minSectionY.load(std::memory_order_acquire); }
+            int getMaxSectionY() const { return m_maxSectionY.load(std::memory_order_acquire); }
+
+            // Bytes propios de la columna (objeto y tablas de punteros), sin las secciones
+            std::size_t getMemoryUsage() const;
+            // Suma de ChunkSection::getMemoryUsage() de todas sus secciones
+            std::size_t getSectionMemoryUsage() const;
+
+
+            // Es necesario Mutex para añadir secciones verticales (solo escritores)
+            mutable std::mutex m_columnMutex;
         private:
-            // Hashmap para las secciones negativas y alturas infinitas
-            std::unordered_map<int,std::unique_ptr<ChunkSection>> m_sections;
+            /**
+             * Array denso de punteros a sección indexado por (yIndex - minY).
+             * Se sustituye entero al crecer; los lectores nunca bloquean.
+             */
+            struct SectionTable {
+                int minY;
+                int capacity;
+                std::unique_ptr<std::atomic<ChunkSection*>[]> slots;
+            };
+
+            void growTable(int yIndex);
+            // Encola la sección si su versión cambió respecto a 'versionBefore' y aún no estaba en la cola
+            void notifyIfChanged(ChunkSection* section, uint64_t versionBefore);
+            // Mantenimiento de alturas. Requieren m_heightmapMutex
+            int scanHeightDown(HeightmapType type, int relX, int relZ, int fromY) const;
+            void updateHeights(int relX, int worldY, int relZ, BlockID block);
+            void refreshHeights(int relX0, int relZ0, int relX1, int relZ1, int worldY1);
+            // Crea la sección con 'fill' si no existe. 'created' indica si la ha creado esta llamada
+            ChunkSection* getOrCreateSection(int yIndex, BlockID fill, bool& created);
+            // Aplica op(sección, yLocal0, yLocal1) a cada sección que corta [worldY0, worldY1]
+            template <typename SectionOp>
+            int forEachSectionInRange(int worldY0, int worldY1, bool create, BlockID fillIfFull, bool fullXZ, SectionOp op);
+
+            ChangeQueue* m_changes;
+            // Las tablas sustituidas se retiran por épocas: un lector puede seguir usándolas
+            std::atomic<SectionTable*> m_table;
+
+            std::atomic<bool> m_lightReady;
+            std::atomic<int> m_minSectionY;
+            std::atomic<int> m_maxSectionY;
+
+            // Alturas por (x,z) indexadas por z * size + x. Las escrituras de bloques se serializan
+            // con m_heightmapMutex para que bloque y altura cambien juntos
+            std::array<std::atomic<int>, CHUNK_SECTION_LAYER> m_heightmaps[HEIGHTMAP_COUNT];
+            std::mutex m_heightmapMutex;
 
     };
 
@@ -3,42 +3,212 @@
 #include <vector>
 #include <atomic>
 #include <array>
+#include <memory>
+#include <mutex>
+#include <cstddef>
+#include <cstdint>
 #include "BlockState.h"
+#include "PalettedContainer.h"
+#include "NibbleArray.h"
+#include "SlabPool.h"
+#include "Epoch.h"
+#include "VoxelLayout.h"
+
+// Lado de la sección como potencia de 2, fijado en compilación (opción de CMake ABYSS_SECTION_SIZE_LOG2).
+// 3 = 8, 4 = 16 (por defecto), 5 = 32. Más de 32 no cabe en los contadores de 16 bits de la paleta
+#ifndef ABYSS_SECTION_SIZE_LOG2
+#define ABYSS_SECTION_SIZE_LOG2 4
+#endif
+static_assert(ABYSS_SECTION_SIZE_LOG2 >= 3 && ABYSS_SECTION_SIZE_LOG2 <= 5,
+              "ABYSS_SECTION_SIZE_LOG2 debe estar entre 3 (8^3) y 5 (32^3)");
 
 namespace AbyssCore {
     //NOTA: constexpr puede evaluar en tiempo de compilación
-    constexpr int CHUNK_SECTION_SIZE = 16;
-    constexpr int CHUNK_SECTION_SIZE_LOG2 = 4;  // Para divisiones con shifts
-    // Máscara de bits para obtener el resto (16 - 1 = 15)
+    constexpr int CHUNK_SECTION_SIZE_LOG2 = ABYSS_SECTION_SIZE_LOG2;  // Para divisiones con shifts
+    constexpr int CHUNK_SECTION_SIZE = 1 << CHUNK_SECTION_SIZE_LOG2;
+    // Máscara de bits para obtener el resto (con 16: 16 - 1 = 15)
     // En binario: 00001111, permite extraer los 4 bits menos significativos
     constexpr int CHUNK_SECTION_MASK = CHUNK_SECTION_SIZE - 1;
 
-    constexpr int CHUNK_SECTION_LAYER = CHUNK_SECTION_SIZE * CHUNK_SECTION_SIZE;     // x*z
-    constexpr int CHUNK_SECTION_LAYER_LOG2 = 8;      // log2(16 * 16), para movernos una capa (Y)
-    
-    
-    constexpr int CHUNK_SECTION_VOLUME =  CHUNK_SECTION_LAYER * CHUNK_SECTION_LAYER; // A*h
+    constexpr int CHUNK_SECTION_LAYER_LOG2 = 2 * CHUNK_SECTION_SIZE_LOG2;   // Para movernos una capa (Y)
+    constexpr int CHUNK_SECTION_LAYER = 1 << CHUNK_SECTION_LAYER_LOG2;      // x*z
+
+    constexpr int CHUNK_SECTION_VOLUME =  CHUNK_SECTION_LAYER * CHUNK_SECTION_SIZE; // A*h
+
+    // Índice plano: (y * size * size) + (z * size) + x
+    // Es el orden de todas las copias densas (snapshot, copyRegion, kernels), sea cual sea el almacenamiento
+    constexpr int sectionIndex(int x, int y, int z){
+        return (y << CHUNK_SECTION_LAYER_LOG2) | (z << CHUNK_SECTION_SIZE_LOG2) | x;
+    }
+
+    // Orden de los vóxeles dentro del PalettedContainer, fijado en compilación (opción de CMake ABYSS_MORTON_LAYOUT).
+    // Lineal favorece recorridos por filas en X; Morton agrupa vecindarios 3D (luz, físicas)
+#if defined(ABYSS_MORTON_LAYOUT)
+    constexpr bool CHUNK_SECTION_MORTON = true;
+    inline int storageIndex(int x, int y, int z){ return Morton::encode(x, y, z); }
+#else
+    constexpr bool CHUNK_SECTION_MORTON = false;
+    constexpr int storageIndex(int x, int y, int z){ return sectionIndex(x, y, z); }
+#endif
+
+    // Consumidores que siguen los cambios de cada sección por separado
+    enum DirtyKind {
+        DIRTY_MESH,
+        DIRTY_LIGHT,
+        DIRTY_SAVE,
+        DIRTY_NETWORK,
+        DIRTY_KIND_COUNT
+    };
+    // Sub-cubos de seguimiento: la sección se divide en 4x4x4 = 64 bloques de bits, una palabra de 64 bits
+    constexpr int DIRTY_CUBES_PER_AXIS = 4;
+    constexpr int DIRTY_CUBE_SHIFT = CHUNK_SECTION_SIZE_LOG2 - 2;  // log2(lado del sub-cubo)
+    constexpr uint64_t DIRTY_ALL_CUBES = ~uint64_t(0);
+    // Máscaras de tipos para markDirty(cubes, kinds)
+    constexpr uint32_t dirtyKindBit(DirtyKind kind){ return 1u << kind; }
+    constexpr uint32_t DIRTY_ALL_KINDS = (1u << DIRTY_KIND_COUNT) - 1;
+
+    // Canales de luz de cada sección, 4 bits por vóxel
+    enum LightType {
+        LIGHT_SKY,      // Luz del cielo: 15 a cielo abierto
+        LIGHT_BLOCK,    // Luz de bloques emisores
+        LIGHT_TYPE_COUNT
+    };
+
+    // Bit del sub-cubo que contiene (x, y, z), mismo orden Y-Z-X que sectionIndex
+    constexpr uint64_t dirtyCubeBit(int x, int y, int z){
+        return uint64_t(1) << (((y >> DIRTY_CUBE_SHIFT) << 4) | ((z >> DIRTY_CUBE_SHIFT) << 2) | (x >> DIRTY_CUBE_SHIFT));
+    }
 
+    /**
+     * @class ChunkSection
+     * @brief Cubo de CHUNK_SECTION_SIZE^3 bloques (16^3 por defecto) con almacenamiento comprimido y control de versiones.
+     *
+     * Concurrencia tipo seqlock: los escritores (serializados por un mutex) ponen la secuencia
+     * en impar mientras modifican y en par al terminar. Los lectores leen con cargas normales
+     * y reintentan si la secuencia cambió, así que nunca escriben memoria compartida.
+     * Los cambios estructurales (crecer/reducir la paleta) publican un contenedor nuevo y
+     * entregan el anterior a EpochManager, que lo libera cuando ningún lector puede seguir en él.
+     *
+     * @note getBlock() requiere un EpochGuard activo en el hilo; World y ChunkColumn lo abren por dentro.
+     */
     class ChunkSection{
         public:
-            ChunkSection(int yIndex);
+            // Una sección nueva es uniforme: no reserva el array de bloques hasta que hace falta
+            ChunkSection(int yIndex, BlockID fill = 0);
+            ~ChunkSection();
+
+            ChunkSection(const ChunkSection&) = delete;
+            ChunkSection& operator=(const ChunkSection&) = delete;
+
+            // Las secciones viven en un SlabPool: crearlas y destruirlas no pasa por el allocator general
+            static void* operator new(std::size_t size);
+            static void operator delete(void* ptr, std::size_t size);
+            static SlabPool& getPool();
 
             // Getters
-            BlockID getBlock(int x, int y, int z) const;
+            // Lectura sin lock: reintenta si coincide con una escritura (secuencia impar o cambiada).
+            // En el header para que los bucles de vecinos puedan inlinearla
+            BlockID getBlock(int x, int y, int z) const {
+                const int index = storageIndex(x, y, z);
+                for(;;){
+                    const uint64_t seq = m_sequence.load(std::memory_order_acquire);
+                    if(seq & 1){
+                        continue; // Escritura en curso
+                    }
+                    const BlockID block = m_storage.load(std::memory_order_acquire)->get(index);
+                    std::atomic_thread_fence(std::memory_order_acquire);
+                    if(m_sequence.load(std::memory_order_relaxed) == seq){
+                        return block;
+                    }
+                }
+            }
             void setBlock(int x, int y, int z, BlockID block);
+            // Rellena la sección entera y vuelve a la representación uniforme
+            void fill(BlockID block);
+
+            // Ediciones masivas: una sola versión nueva y una sola actualización del contador por lote.
+            // Las cajas son inclusivas en coordenadas locales [0, 15]
+            void fillBox(int x0, int y0, int z0, int x1, int y1, int z1, BlockID block);
+            void fillLayer(int y, BlockID block);
+            // Copia 'count' bloques consecutivos en X empezando en (x0, y, z)
+            void setRow(int x0, int y, int z, const BlockID* blocks, int count);
+            // Sustituye 'from' por 'to' dentro de la caja. Devuelve cuántos bloques cambió
+            int replaceInBox(int x0, int y0, int z0, int x1, int y1, int z1, BlockID from, BlockID to);
+
+            // Copia consistente de los CHUNK_SECTION_VOLUME bloques (orden sectionIndex).
+            // Devuelve la versión a la que corresponde la copia
+            uint64_t snapshot(BlockID* out) const;
+            // Copia consistente de una caja local inclusiva a out[(y-y0)*strideY + (z-z0)*strideZ + (x-x0)]
+            uint64_t copyRegion(int x0, int y0, int z0, int x1, int y1, int z1,
+                                BlockID* out, int strideZ, int strideY) const;
+            // Número de escrituras aplicadas; sirve a mallas, luz o guardado para detectar cambios
+            uint64_t getVersion() const { return m_sequence.load(std::memory_order_acquire) >> 1; }
             /**/
             // Estado
-            bool isEmpty() const {}
-            int getYIndex() const {}
+            bool isEmpty() const { return m_blockCount.load(std::memory_order_relaxed) == 0; }
+            int getYIndex() const { return m_yIndex; }
+            int getBlockCount() const { return m_blockCount.load(std::memory_order_relaxed); }
+            // Bloques con BlockRegistry::ticksRandomly: con 0 el tick aleatorio salta la sección
+            int getTickableCount() const { return m_tickableCount.load(std::memory_order_relaxed); }
+            bool isUniform() const;
+
+            // Seguimiento de cambios: cada tipo de consumidor tiene su propia máscara de sub-cubos
+            bool isDirty(DirtyKind kind) const { return m_dirtyCubes[kind].load(std::memory_order_acquire) != 0; }
+            uint64_t getDirtyCubes(DirtyKind kind) const { return m_dirtyCubes[kind].load(std::memory_order_acquire); }
+            // Devuelve la máscara pendiente y la deja limpia (el consumidor se hace cargo de esos sub-cubos)
+            uint64_t takeDirty(DirtyKind kind) { return m_dirtyCubes[kind].exchange(0, std::memory_order_acq_rel); }
+            void markDirty(uint64_t cubes, uint32_t kinds = DIRTY_ALL_KINDS);
+            // true solo para el primer llamante desde el último clearNotification(): evita duplicados en la cola
+            bool claimNotification() { return !m_notifyPending.exchange(true, std::memory_order_acq_rel); }
+            void clearNotification() { m_notifyPending.store(false, std::memory_order_release); }
+
+            // Luz por vóxel (orden sectionIndex). Solo la escribe el motor de luz; leerla requiere un EpochGuard.
+            // Una sección nueva nace con cielo 15 y luz de bloques 0, sin reservar memoria
+            uint8_t getLight(LightType type, int x, int y, int z) const { return m_light[type].get(sectionIndex(x, y, z)); }
+            void setLight(LightType type, int x, int y, int z, uint8_t level) { m_light[type].set(sectionIndex(x, y, z), level); }
+            NibbleArray& getLightArray(LightType type) { return m_light[type]; }
+            const NibbleArray& getLightArray(LightType type) const { return m_light[type]; }
+
+            // Recalcula m_blockCount y m_tickableCount recorriendo la sección (migraciones, validación
+            // tras cargar, o secciones creadas antes de BlockRegistry::init)
+            int recountBlocks();
+            // Y local más alta no aire por columna en heights[z * size + x], -1 si vacía
+            void getHighestNonAir(int8_t* heights) const;
+
+            // Diagnóstico del almacenamiento comprimido
+            int getBitsPerBlock() const;
+            std::size_t getMemoryUsage() const;
 
         private:
+            // A partir de este volumen un lote se aplica sobre una copia densa y se recodifica
+            static constexpr int DENSE_EDIT_THRESHOLD = CHUNK_SECTION_VOLUME / 8;
+
+            void beginWrite();
+            void endWrite();
+            void publish(std::unique_ptr<PalettedContainer> next);
+            void compactIfNeeded(const PalettedContainer* storage);
+
+            // edit(actual, x, y, z) -> bloque nuevo. Devuelve el número de bloques cambiados
+            template <typename EditFn>
+            int editBox(int x0, int y0, int z0, int x1, int y1, int z1, EditFn edit);
+
             int m_yIndex;
             std::atomic<int> m_blockCount;
-            std::array<std::atomic<BlockID>, CHUNK_SECTION_VOLUME> m_blocks;
+            std::atomic<int> m_tickableCount;
+
+            // Secuencia del seqlock: impar = escritura en curso. Versión = secuencia / 2
+            std::atomic<uint64_t> m_sequence;
+            mutable std::mutex m_writeMutex;
+            std::atomic<PalettedContainer*> m_storage;
+
+            NibbleArray m_light[LIGHT_TYPE_COUNT];
+
+            std::atomic<uint64_t> m_dirtyCubes[DIRTY_KIND_COUNT];
+            std::atomic<bool> m_notifyPending;
     };
 
 }
 
 
 
-#endif // CHUNKSECTION_H
\ No newline at end of file
+#endif // CHUNKSECTION_H
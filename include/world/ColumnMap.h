@@ -0,0 +1,95 @@
+#ifndef COLUMNMAP_H
+#define COLUMNMAP_H
+#include <atomic>
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <cstdint>
+#include <cstddef>
+#include "Epoch.h"
+
+namespace AbyssCore {
+
+    class ChunkColumn;
+
+    // Clave de columna: X en los 32 bits altos, Z en los bajos
+    constexpr uint64_t packColumnKey(int chunkX, int chunkZ){
+        return (static_cast<uint64_t>(static_cast<uint32_t>(chunkX)) << 32) | static_cast<uint32_t>(chunkZ);
+    }
+
+    /**
+     * @class ColumnMap
+     * @brief Tabla hash concurrente (direccionamiento abierto) de columnas por clave de 64 bits.
+     *
+     * Las búsquedas no bloquean: recorren la tabla publicada con cargas acquire. Inserciones y
+     * borrados se serializan con un mutex; un borrado deja el hueco como lápida (valor nulo con la
+     * clave intacta) para no romper cadenas de sondeo. Al crecer se publica una tabla nueva y la
+     * anterior se retira a EpochManager, porque un lector puede seguir recorriéndola.
+     *
+     * @note El mapa no es dueño de las columnas: World decide cuándo liberarlas.
+     *       find() y forEach() requieren un EpochGuard activo en el hilo.
+     */
+    class ColumnMap {
+        public:
+            ColumnMap();
+            ~ColumnMap();
+
+            ColumnMap(const ColumnMap&) = delete;
+            ColumnMap& operator=(const ColumnMap&) = delete;
+
+            ChunkColumn* find(uint64_t key) const;
+            // Inserta si no existe. Devuelve la columna que queda en el mapa
+            ChunkColumn* insert(uint64_t key, ChunkColumn* column);
+            // Quita la columna y la devuelve (nullptr si no estaba)
+            ChunkColumn* remove(uint64_t key);
+
+            std::size_t size() const { return m_count.load(std::memory_order_relaxed); }
+
+            // Recorre las columnas vivas de la tabla actual sin bloquear
+            template <typename Fn>
+            void forEach(Fn fn) const {
+                const Table* table = m_table.load(std::memory_order_acquire);
+                for(std::size_t i = 0; i <= table->mask; i++){
+                    ChunkColumn* column = table->slots[i].value.load(std::memory_order_acquire);
+                    if(column != nullptr){
+                        fn(column);
+                    }
+                }
+            }
+
+            // Bytes de la tabla actual (las columnas no se incluyen)
+            std::size_t getMemoryUsage() const;
+
+        private:
+            struct Slot {
+                std::atomic<bool> used;
+                std::atomic<uint64_t> key;
+                std::atomic<ChunkColumn*> value;
+            };
+            struct Table {
+                std::size_t mask;    // capacidad - 1 (potencia de 2)
+                std::unique_ptr<Slot[]> slots;
+            };
+
+            static constexpr std::size_t INITIAL_CAPACITY = 256;
+
+            static std::size_t hash(uint64_t key){
+                // Mezcla de splitmix64: las coordenadas vecinas quedan repartidas por la tabla
+                key ^= key >> 30;
+                key *= 0xBF58476D1CE4E5B9ull;
+                key ^= key >> 27;
+                key *= 0x94D049BB133111EBull;
+                key ^= key >> 31;
+                return static_cast<std::size_t>(key);
+            }
+            static Table* createTable(std::size_t capacity);
+            void rehash(std::size_t capacity);
+
+            std::atomic<Table*> m_table;
+            mutable std::mutex m_writeMutex;
+            std::atomic<std::size_t> m_count;
+            std::size_t m_usedSlots;    // Vivos + lápidas, decide cuándo rehacer la tabla
+    };
+}
+
+#endif // COLUMNMAP_H
@@ -0,0 +1,110 @@
+#ifndef EPOCH_H
+#define EPOCH_H
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <cstddef>
+#include <cstdint>
+
+namespace AbyssCore {
+
+    /**
+     * @class EpochManager
+     * @brief Reclamación de memoria por épocas para las estructuras de lectura sin lock del mundo.
+     *
+     * Un lector entra en una sección crítica con EpochGuard y anuncia la época global actual.
+     * Lo que un escritor desengancha (contenedores de bloques, tablas, columnas descargadas) se
+     * entrega a retire() etiquetado con la época del momento, y solo se libera cuando la época
+     * global ha avanzado dos veces: para entonces ningún lector anunciado puede seguir viéndolo.
+     * La época avanza cuando todos los hilos dentro de un guard han anunciado la actual.
+     *
+     * @note Thread-Safe. Los punteros a secciones o columnas obtenidos sin lock solo son válidos
+     *       mientras el hilo tenga un EpochGuard activo.
+     */
+    class EpochManager {
+        public:
+            static EpochManager& getInstance();
+
+            // Entrega un objeto ya inaccesible para nuevos lectores; se hará delete cuando sea seguro
+            template <typename T>
+            void retire(T* ptr) {
+                retireRaw(ptr, [](void* object){ delete static_cast<T*>(object); });
+            }
+            void retireRaw(void* ptr, void (*deleter)(void*));
+
+            // Intenta avanzar la época y libera todo lo que ya no puede estar en uso.
+            // Devuelve el número de objetos liberados
+            std::size_t collect();
+
+            uint64_t getEpoch() const { return m_epoch.load(std::memory_order_acquire); }
+            // Objetos retirados aún pendientes de liberar
+            std::size_t getPendingCount() const { return m_pending.load(std::memory_order_relaxed); }
+
+            // Usados por EpochGuard solo en el guard más externo del hilo
+            void enter();
+            void exit();
+
+        private:
+            // Liberaciones automáticas: cada hilo intenta recoger tras este número de retire()
+            static constexpr int COLLECT_INTERVAL = 64;
+
+            struct Retired {
+                void* ptr;
+                void (*deleter)(void*);
+                uint64_t epoch;
+            };
+            // Estado de un hilo. Se reutiliza cuando el hilo termina, nunca se libera mientras viva el gestor
+            struct ThreadRecord {
+                std::atomic<uint64_t> state{0};     // (época << 1) | 1 dentro de un guard, 0 fuera
+                std::atomic<bool> inUse{false};
+                int retiredSinceCollect = 0;
+                std::mutex limboMutex;
+                std::vector<Retired> limbo;
+                ThreadRecord* next = nullptr;
+            };
+            struct RecordHandle;
+
+            EpochManager();
+            ~EpochManager();
+
+            ThreadRecord* getRecord();
+            bool tryAdvance();
+
+            std::atomic<uint64_t> m_epoch;
+            std::atomic<ThreadRecord*> m_records;   // Lista solo de inserción
+            std::atomic<std::size_t> m_pending;
+    };
+
+    /**
+     * @class EpochGuard
+     * @brief RAII: mientras existe, nada de lo que el hilo lea del mundo se libera.
+     *
+     * Entrar anidado solo incrementa un contador por hilo (inline), así que las funciones del mundo
+     * pueden protegerse por dentro sin coste relevante cuando el llamante ya tiene un guard abierto.
+     * El guard externo sí paga el anuncio con barrera: conviene abrir uno por trabajo, no por lectura.
+     *
+     * @note Ligado al hilo que lo crea: no debe moverse a otro hilo.
+     */
+    class EpochGuard {
+        public:
+            EpochGuard() {
+                if(s_depth++ == 0){
+                    EpochManager::getInstance().enter();
+                }
+            }
+            ~EpochGuard() {
+                if(--s_depth == 0){
+                    EpochManager::getInstance().exit();
+                }
+            }
+
+            EpochGuard(const EpochGuard&) = delete;
+            EpochGuard& operator=(const EpochGuard&) = delete;
+
+        private:
+            // Guards abiertos en el hilo actual
+            inline static thread_local int s_depth = 0;
+    };
+}
+
+#endif // EPOCH_H
@@ -0,0 +1,130 @@
+#ifndef FLUIDSIMULATION_H
+#define FLUIDSIMULATION_H
+#include <vector>
+#include <atomic>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <functional>
+#include <cstdint>
+#include "World.h"
+#include "BlockRegistry.h"
+
+namespace AbyssCore {
+
+    // Parámetros de un fluido registrado en BlockRegistry con LEVEL y FALLING
+    struct FluidType {
+        BlockTypeID block;
+        int levelDrop;          // Niveles que pierde por bloque en horizontal
+        int maxLevel;           // Más allá de este nivel el fluido no llega (como mucho 7)
+        int tickDelay;          // Ticks del juego entre dos pasos de la simulación
+        bool infiniteSources;   // Dos fuentes vecinas sobre suelo firme crean otra (agua)
+    };
+
+    // Cambio aplicado por la simulación, para luz, mallas o red
+    struct FluidChange {
+        int x, y, z;
+        BlockID oldBlock;
+        BlockID newBlock;
+    };
+
+    /**
+     * @class FluidSimulation
+     * @brief Agua y lava como autómata celular sobre un frente de celdas activas.
+     *
+     * Cada paso solo evalúa las celdas cuyo vecindario cambió en el paso anterior (o que se
+     * activaron con onBlockChanged). El estado nuevo de una celda depende solo de ella y de sus
+     * vecinas en el estado anterior, así que el paso va en dos fases con barrera:
+     * 1. Evaluar: cada trabajo lee el mundo (sin escribir) y apunta los cambios de sus celdas.
+     * 2. Aplicar: cada trabajo escribe sus cambios en sus propias columnas.
+     * Los trabajos son tramos del frente ordenado por columna, así que corren en paralelo sin
+     * compartir nada. Un fluido asentado no cambia, no activa a nadie y sale del frente.
+     *
+     * Cada fluido avanza cada FluidType::tickDelay ticks, como si todo su frente fuera un tick
+     * programado con ese retraso (agua 5, lava 30).
+     *
+     * Reglas (por fluido, los demás bloques y el otro fluido cuentan como sólidos):
+     * - Una fuente (nivel 0) no cambia.
+     * - Con el mismo fluido encima, la celda es fluido cayendo (se extiende como una fuente).
+     * - Si no, recibe de cada vecina horizontal que no esté cayendo por su propio hueco su nivel
+     *   más levelDrop y se queda con el menor; por encima de maxLevel se seca.
+     *
+     * @note Solo el hilo de lógica llama a tick() y onBlockChanged(). Por debajo de la sección
+     *       más baja de una columna y en columnas no cargadas el fluido no pasa. Coordenadas
+     *       limitadas a Y en [-2048, 2047] y a ±2^19 columnas.
+     */
+    class FluidSimulation {
+        public:
+            // workerThreads: hilos además del que llama a tick() (0 = todo en ese hilo)
+            FluidSimulation(World& world, int workerThreads = 0);
+            ~FluidSimulation();
+
+            FluidSimulation(const FluidSimulation&) = delete;
+            FluidSimulation& operator=(const FluidSimulation&) = delete;
+
+            // Agua y lava vienen registradas; sirve para fluidos nuevos
+            void addFluid(const FluidType& fluid);
+
+            // Un bloque cambió por otro camino (jugador, generación): se evalúan él y sus vecinos
+            void onBlockChanged(int x, int y, int z);
+            // Un tick del juego: avanza los fluidos a los que les toca
+            void tick();
+            // Un paso de un fluido sin esperar a su tickDelay. Devuelve las celdas evaluadas
+            int step(int fluidIndex);
+
+            // Cambios aplicados en el último tick()
+            const std::vector<FluidChange>& getChanges() const { return m_changes; }
+            std::size_t getActiveCount() const;
+            uint64_t getCellsProcessed() const { return m_cellsProcessed; }
+            int getFluidCount() const { return static_cast<int>(m_fluids.size()); }
+            int getWorkerCount() const { return static_cast<int>(m_threads.size()); }
+
+        private:
+            struct Fluid {
+                FluidType type;
+                // Se resuelven en cada paso: la simulación puede crearse antes de BlockRegistry::init
+                BlockID base;
+                BlockID falling;
+                BlockID stateCount;
+                std::vector<uint64_t> frontier;     // Celdas empaquetadas (packCell), con duplicados
+            };
+            // Tramo [begin, end) del frente, sin partir columnas
+            struct Job {
+                std::size_t begin, end;
+            };
+            static constexpr std::size_t JOB_CELLS = 1024;
+
+            void activate(int x, int y, int z);
+            void evaluateJob(const Fluid& fluid, const std::vector<uint64_t>& cells, const Job& job,
+                             std::vector<FluidChange>& out) const;
+            void applyJob(const std::vector<FluidChange>& changes);
+            // Ejecuta fn(i) para i en [0, jobs) entre los trabajadores y el hilo que llama
+            void runJobs(int jobs, const std::function<void(int)>& fn);
+            void runPendingJobs();
+            void workerLoop();
+
+            World& m_world;
+            const BlockRegistry& m_registry;
+            std::vector<Fluid> m_fluids;
+            uint64_t m_tick;
+            uint64_t m_cellsProcessed;
+
+            std::vector<Job> m_jobs;
+            std::vector<std::vector<FluidChange>> m_results;   // Uno por trabajo
+            std::vector<FluidChange> m_changes;
+
+            // Trabajadores
+            std::vector<std::thread> m_threads;
+            std::mutex m_mutex;
+            std::condition_variable m_wake;
+            std::condition_variable m_done;
+            const std::function<void(int)>* m_jobFn;
+            int m_jobCount;
+            std::atomic<int> m_nextJob;
+            int m_busyWorkers;
+            uint64_t m_generation;
+            bool m_stopping;
+    };
+}
+
+#endif // FLUIDSIMULATION_H
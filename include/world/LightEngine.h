@@ -0,0 +1,114 @@
+#ifndef LIGHTENGINE_H
+#define LIGHTENGINE_H
+#include <vector>
+#include <cstdint>
+#include "World.h"
+#include "BlockRegistry.h"
+
+namespace AbyssCore {
+
+    // Posición pendiente en las colas de propagación
+    struct LightNode {
+        int x, y, z;
+        uint8_t level;      // Nivel que tenía al encolarse (lo usa el borrado)
+    };
+
+    /**
+     * @class LightEngine
+     * @brief Luz del cielo y de bloques por BFS sobre las secciones del mundo.
+     *
+     * Cada vóxel recibe el máximo de sus 6 vecinos menos max(1, opacidad propia); la luz del
+     * cielo baja sin perder nivel mientras el bloque no atenúe. Opacidad y emisión salen de las
+     * tablas por estado de BlockRegistry.
+     *
+     * - lightColumn(): columna recién generada o cargada. Siembra el cielo en vertical desde el
+     *   mapa de alturas (secciones enteras quedan uniformes, sin memoria) y solo encola las celdas
+     *   que pueden repartir luz hacia los lados o hacia columnas vecinas ya cargadas.
+     * - onBlockChanged()/setBlock(): borrado BFS de la luz que dependía del bloque y repropagación
+     *   desde los bordes de la zona borrada. Se acumulan y se resuelven en update().
+     *
+     * Secciones que no existen: por encima de la más alta o en huecos de la columna valen cielo 15
+     * y bloque 0 (aire a cielo abierto) y se crean al escribir en ellas; por debajo de la más baja
+     * y en columnas no cargadas o aún sin iluminar la luz no pasa.
+     *
+     * @note Un único hilo escribe la luz (el de lógica); los demás la leen sin bloquear con
+     *       ChunkSection::getLight dentro de un EpochGuard. Las secciones con luz nueva se marcan
+     *       para malla, guardado y red y se encolan como un cambio más en World::drainChanges.
+     */
+    class LightEngine {
+        public:
+            explicit LightEngine(World& world);
+
+            // Ilumina una columna recién generada o cargada y propaga hacia sus vecinas cargadas
+            void lightColumn(int chunkX, int chunkZ);
+
+            // Escribe el bloque en el mundo y encola su efecto en la luz
+            void setBlock(int x, int y, int z, BlockID block);
+            // Para escrituras que ya se han hecho en el mundo por otro camino
+            void onBlockChanged(int x, int y, int z, BlockID oldBlock, BlockID newBlock);
+            // Procesa las colas pendientes (una vez por tick)
+            void update();
+            bool hasPendingUpdates() const;
+
+            // Nivel en coordenadas mundiales con las mismas reglas que usa la propagación
+            uint8_t getLight(LightType type, int x, int y, int z) const;
+
+            // --- Piezas sueltas para LightScheduler (una instancia por hilo). Requieren un EpochGuard
+            //     activo y flush() antes de soltarlo ---
+            // Solo escribe en las columnas [chunkX0, chunkX1] x [chunkZ0, chunkZ1]. Un paso que sale de
+            // ahí deja el nodo en getSpills(lado) para la región vecina (lados -X, +X, -Z, +Z)
+            void setRegion(int chunkX0, int chunkZ0, int chunkX1, int chunkZ1);
+            // Cielo y emisores de la columna sin propagar; no lee columnas vecinas
+            void seedColumn(int chunkX, int chunkZ);
+            void enqueueColumnBorders(int chunkX, int chunkZ);
+            void propagateRemovals(LightType type);
+            void propagateAdds(LightType type);
+            void flush();
+            std::vector<LightNode>& getAddQueue(LightType type) { return m_addQueue[type]; }
+            std::vector<LightNode>& getRemoveQueue(LightType type) { return m_removeQueue[type]; }
+            std::vector<LightNode>& getSpills(int side, LightType type) { return m_spills[side][type]; }
+
+        private:
+            // Resultado de resolver una sección
+            enum SlotState : uint8_t {
+                SLOT_EMPTY,         // Entrada de caché libre
+                SLOT_SECTION,       // Sección existente
+                SLOT_OPEN,          // Sin sección pero iluminable (encima de la columna o hueco)
+                SLOT_BLOCKED,       // Columna no cargada o por debajo de la columna
+            };
+            struct SectionSlot {
+                int chunkX, sectionY, chunkZ;
+                SlotState state;
+                ChunkColumn* column;
+                ChunkSection* section;
+                uint64_t dirty;     // Sub-cubos con luz escrita pendientes de marcar
+            };
+            static constexpr int SLOT_CACHE_SIZE = 64;  // Potencia de 2
+
+            SectionSlot& slotAt(int x, int y, int z);
+            static uint8_t readLight(const SectionSlot& slot, LightType type, int x, int y, int z);
+            static BlockID readBlock(const SectionSlot& slot, int x, int y, int z);
+            void writeLight(SectionSlot& slot, LightType type, int x, int y, int z, uint8_t level);
+            bool owns(int x, int z) const {
+                const int chunkX = x >> CHUNK_SECTION_SIZE_LOG2, chunkZ = z >> CHUNK_SECTION_SIZE_LOG2;
+                return chunkX >= m_regionX0 && chunkX <= m_regionX1 && chunkZ >= m_regionZ0 && chunkZ <= m_regionZ1;
+            }
+            void seedSky(ChunkColumn* column, int minSectionY, int maxSectionY);
+            // Sin bloques emisores registrados no se buscan fuentes
+            bool hasEmitters() const;
+            void seedEmitters(ChunkColumn* column, int minSectionY, int maxSectionY);
+            void enqueueBorders(ChunkColumn* column, int minSectionY);
+
+            World& m_world;
+            const BlockRegistry& m_registry;
+            int m_regionX0, m_regionZ0, m_regionX1, m_regionZ1;     // Sin límites salvo en LightScheduler
+
+            std::vector<LightNode> m_addQueue[LIGHT_TYPE_COUNT];
+            std::vector<LightNode> m_removeQueue[LIGHT_TYPE_COUNT];
+            std::vector<LightNode> m_spills[4][LIGHT_TYPE_COUNT];
+            SectionSlot m_slots[SLOT_CACHE_SIZE];
+            std::vector<BlockID> m_blocks;  // Copia densa de la sección que se está sembrando
+    };
+}
+
+#endif // LIGHTENGINE_H
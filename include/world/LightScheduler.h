@@ -0,0 +1,121 @@
+#ifndef LIGHTSCHEDULER_H
+#define LIGHTSCHEDULER_H
+#include <vector>
+#include <deque>
+#include <memory>
+#include <mutex>
+#include <condition_variable>
+#include <thread>
+#include <unordered_map>
+#include <utility>
+#include "LightEngine.h"
+
+namespace AbyssCore {
+
+    // Lado de una región de luz en columnas como potencia de 2 (1 = regiones de 2x2 columnas)
+    constexpr int LIGHT_REGION_SHIFT = 1;
+    constexpr int LIGHT_REGION_SIZE = 1 << LIGHT_REGION_SHIFT;
+
+    /**
+     * @class LightScheduler
+     * @brief Reparte el trabajo de luz por regiones de columnas entre varios hilos.
+     *
+     * Cada región (LIGHT_REGION_SIZE x LIGHT_REGION_SIZE columnas) la procesa un solo hilo a la
+     * vez con su propio LightEngine, que solo escribe dentro de la región. Un paso de BFS que
+     * cruza a una región vecina se deja en la bandeja de entrada de esa vecina para el lado por
+     * el que llega: cada bandeja tiene un único productor, así que su mutex casi nunca compite,
+     * y ningún hilo toma el lock de otra columna para propagar.
+     *
+     * update() ejecuta tres fases separadas por una barrera, en el mismo orden que LightEngine:
+     * 1. Siembra de las columnas pedidas (cada una por su cuenta, sin leer vecinas).
+     * 2. Borrados de los cambios de bloques, con sus reenvíos entre regiones.
+     * 3. Propagación: bordes de las columnas nuevas, emisores y repropagación de lo borrado.
+     * Dentro de cada fase las regiones independientes corren en paralelo; una región que recibe
+     * trabajo mientras se procesa se vuelve a encolar al terminar.
+     *
+     * @note requestColumn(), setBlock() y update() se llaman desde un único hilo (el de lógica);
+     *       el hilo que llama a update() también procesa regiones mientras espera.
+     * @note Escalado sin medir: solo se ha probado en una máquina de un núcleo, donde es más lento
+     *       que LightEngine en serie (light_parallel: ~117 frente a 139-174 us/columna). Hay que
+     *       medirlo en varios núcleos antes de contar con la aceleración.
+     */
+    class LightScheduler {
+        public:
+            // workerThreads: hilos además del que llama a update() (0 = todo en ese hilo)
+            LightScheduler(World& world, int workerThreads);
+            ~LightScheduler();
+
+            LightScheduler(const LightScheduler&) = delete;
+            LightScheduler& operator=(const LightScheduler&) = delete;
+
+            // Columna recién generada o cargada: se ilumina en el siguiente update()
+            void requestColumn(int chunkX, int chunkZ);
+            // Igual que en LightEngine: el efecto en la luz se resuelve en el siguiente update()
+            void setBlock(int x, int y, int z, BlockID block);
+            void onBlockChanged(int x, int y, int z, BlockID oldBlock, BlockID newBlock);
+            // Procesa todo lo pendiente y vuelve cuando la luz está estable
+            void update();
+
+            uint8_t getLight(LightType type, int x, int y, int z) const { return m_main.getLight(type, x, y, z); }
+            int getWorkerCount() const { return static_cast<int>(m_threads.size()); }
+            // Regiones vivas; entre dos update() no queda ninguna sin trabajo
+            std::size_t getRegionCount() const { return m_regions.size(); }
+
+        private:
+            enum Phase {
+                PHASE_SEED,
+                PHASE_REMOVE,
+                PHASE_ADD,
+            };
+
+            struct Region {
+                int regionX, regionZ;
+                std::vector<std::pair<int, int>> columns;           // Pedidas, hasta encolar sus bordes
+                std::vector<LightNode> pendingRemovals[LIGHT_TYPE_COUNT];
+                std::vector<LightNode> pendingAdds[LIGHT_TYPE_COUNT];
+                // Reenvíos de la región vecina de cada lado (-X, +X, -Z, +Z); un productor por bandeja
+                std::mutex inboxMutex[4];
+                std::vector<LightNode> inbox[4][LIGHT_TYPE_COUNT];
+                // Protegidos por m_mutex
+                bool touched = false;   // Tiene trabajo para este update()
+                bool queued = false;
+                bool running = false;
+                bool rerun = false;     // Recibió reenvíos mientras se procesaba
+            };
+
+            // Requieren m_mutex
+            Region& regionAt(int regionX, int regionZ);
+            Region& regionOf(int x, int z);
+            void touch(Region& region);
+            void schedule(Region& region);
+            // Sin columnas, colas ni bandejas pendientes: se puede borrar al final de update()
+            static bool isIdle(const Region& region);
+
+            void runPhase(Phase phase);
+            void workerLoop(int index);
+            // Saca una región de m_ready y la procesa con m_mutex liberado. Requiere m_mutex (tomado en 'lock')
+            void runReady(std::unique_lock<std::mutex>& lock, LightEngine& engine);
+            void process(Region& region, LightEngine& engine);
+            void deliverSpills(const Region& region, LightEngine& engine);
+            // Pasa a las regiones el trabajo que dejó m_main al aplicar cambios de bloques
+            void distributeMainQueues();
+
+            // Cambios de bloques desde el hilo de lógica; no tiene límites de región
+            LightEngine m_main;
+            // Uno por hilo: [0] el que llama a update(), después uno por trabajador
+            std::vector<std::unique_ptr<LightEngine>> m_engines;
+
+            std::mutex m_mutex;
+            std::condition_variable m_wake;     // Hay regiones listas, la fase terminó o toca parar
+            // Solo las regiones con trabajo en curso; las que se quedan sin él se borran en update()
+            std::unordered_map<uint64_t, std::unique_ptr<Region>> m_regions;
+            std::vector<Region*> m_touched;     // Todas las regiones creadas desde el último update()
+            std::deque<Region*> m_ready;
+            Phase m_phase;
+            int m_running;
+            bool m_stopping;
+            std::vector<std::thread> m_threads;
+    };
+}
+
+#endif // LIGHTSCHEDULER_H
@@ -0,0 +1,73 @@
+#ifndef NIBBLEARRAY_H
+#define NIBBLEARRAY_H
+#include <atomic>
+#include <cstdint>
+#include <cstddef>
+
+namespace AbyssCore {
+
+    /**
+     * @class NibbleArray
+     * @brief Valores de 4 bits (0..15) por vóxel, dos por byte, con modo uniforme sin memoria.
+     *
+     * Pensado para la luz: la mayoría de secciones están enteras a 15 (cielo abierto) o a 0
+     * (roca, sin fuentes), y en ese caso solo se guarda el valor común. El array de 'size' / 2
+     * bytes se reserva con el primer set() de un valor distinto y se vuelve a soltar con fill()
+     * o compact().
+     *
+     * @note Un único escritor a la vez (el motor de luz). Los lectores de otros hilos no bloquean:
+     *       ven el valor anterior o el nuevo de cada vóxel, y un array soltado se retira por épocas,
+     *       así que leer requiere un EpochGuard activo. Los bytes son atómicos con orden relaxed
+     *       (en x86 un mov normal): el borde de una región de LightScheduler lee la luz de la
+     *       vecina mientras el hilo de esa región la escribe.
+     */
+    class NibbleArray {
+        public:
+            explicit NibbleArray(int size, uint8_t uniform = 0);
+            ~NibbleArray();
+
+            NibbleArray(const NibbleArray&) = delete;
+            NibbleArray& operator=(const NibbleArray&) = delete;
+
+            uint8_t get(int index) const {
+                const std::atomic<uint8_t>* data = m_data.load(std::memory_order_acquire);
+                if(data == nullptr){
+                    return m_uniform.load(std::memory_order_relaxed);
+                }
+                return (data[index >> 1].load(std::memory_order_relaxed) >> ((index & 1) << 2)) & 0xF;
+            }
+            void set(int index, uint8_t value){
+                std::atomic<uint8_t>* data = m_data.load(std::memory_order_relaxed);
+                if(data == nullptr){
+                    if(value == m_uniform.load(std::memory_order_relaxed)){
+                        return;
+                    }
+                    data = materialize();
+                }
+                const int shift = (index & 1) << 2;
+                // Un solo escritor: leer y escribir por separado basta, sin compare-exchange
+                std::atomic<uint8_t>& byte = data[index >> 1];
+                const uint8_t old = byte.load(std::memory_order_relaxed);
+                byte.store(static_cast<uint8_t>((old & ~(0xF << shift)) | ((value & 0xF) << shift)), std::memory_order_relaxed);
+            }
+            // Todos los vóxeles al mismo valor; suelta el array
+            void fill(uint8_t value);
+            // Si todos los vóxeles coinciden vuelve al modo uniforme. Devuelve true si lo ha hecho
+            bool compact();
+
+            bool isUniform() const { return m_data.load(std::memory_order_acquire) == nullptr; }
+            uint8_t getUniformValue() const { return m_uniform.load(std::memory_order_relaxed); }
+            std::size_t getMemoryUsage() const;
+
+        private:
+            // Reserva el array relleno con el valor uniforme y lo publica
+            std::atomic<uint8_t>* materialize();
+            void release();
+
+            int m_size;
+            std::atomic<std::atomic<uint8_t>*> m_data;
+            std::atomic<uint8_t> m_uniform;     // Solo válido sin array
+    };
+}
+
+#endif // NIBBLEARRAY_H
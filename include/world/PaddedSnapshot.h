@@ -0,0 +1,54 @@
+#ifndef PADDEDSNAPSHOT_H
+#define PADDEDSNAPSHOT_H
+#include <vector>
+#include <cstdint>
+#include "World.h"
+
+namespace AbyssCore {
+
+    /**
+     * @class PaddedSnapshot
+     * @brief Copia densa y no atómica de una sección más un borde de 'padding' bloques de sus vecinas.
+     *
+     * Con padding 1 es el cubo 18x18x18 que necesitan mallado y luz. La extracción recorre las
+     * hasta 27 secciones implicadas una sola vez cada una y guarda su versión, de modo que un
+     * trabajo puede ejecutarse sin locks sobre su copia privada y comprobar después si quedó obsoleta.
+     *
+     * @note Disposición Y-Z-X con lado getDim(); las coordenadas van de -padding a 15 + padding.
+     */
+    class PaddedSnapshot {
+        public:
+            // Versión registrada para una vecina que no existía al extraer
+            static constexpr uint64_t MISSING_SECTION = UINT64_MAX;
+
+            // padding en [0, 16]
+            explicit PaddedSnapshot(int padding = 1);
+
+            void extract(const World& world, int chunkX, int sectionY, int chunkZ);
+            // true si alguna de las secciones copiadas ha cambiado (o ha aparecido) desde extract()
+            bool isStale(const World& world) const;
+
+            BlockID get(int x, int y, int z) const { return m_blocks[index(x, y, z)]; }
+            int index(int x, int y, int z) const {
+                return ((y + m_padding) * m_dim + (z + m_padding)) * m_dim + (x + m_padding);
+            }
+            const BlockID* data() const { return m_blocks.data(); }
+            int getDim() const { return m_dim; }
+            int getPadding() const { return m_padding; }
+            int getChunkX() const { return m_chunkX; }
+            int getSectionY() const { return m_sectionY; }
+            int getChunkZ() const { return m_chunkZ; }
+
+        private:
+            static const ChunkSection* findSection(const World& world, int chunkX, int sectionY, int chunkZ);
+
+            int m_padding;
+            int m_dim;
+            int m_chunkX, m_sectionY, m_chunkZ;
+            std::vector<BlockID> m_blocks;
+            // Versión de cada sección del cubo 3x3x3, índice (sy+1)*9 + (sz+1)*3 + (sx+1)
+            uint64_t m_versions[27];
+    };
+}
+
+#endif // PADDEDSNAPSHOT_H
@@ -0,0 +1,115 @@
+#ifndef PALETTEDCONTAINER_H
+#define PALETTEDCONTAINER_H
+#include <vector>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+#include "BlockState.h"
+
+namespace AbyssCore {
+
+    /**
+     * @class PalettedContainer
+     * @brief Almacenamiento comprimido de bloques mediante paleta + índices empaquetados.
+     *
+     * En lugar de guardar un BlockID de 32 bits por vóxel, se guarda una paleta con los
+     * bloques distintos presentes y, por cada vóxel, un índice a esa paleta empaquetado
+     * en palabras de 64 bits con 1, 2, 4, 8 o 16 bits por bloque.
+     * El ancho crece cuando la paleta se llena y decrece cuando se vacían entradas.
+     * Con 0 bits el contenedor es uniforme: guarda un único BlockID y ningún array,
+     * que solo se materializa con el primer set() que introduce un bloque distinto.
+     *
+     * @note No es Thread-Safe; la sincronización es responsabilidad de ChunkSection.
+     *       Un set() para el que canSetInPlace() es true no realoja ningún buffer que lean get()/decode(),
+     *       lo que permite a ChunkSection escribir in situ bajo su seqlock.
+     */
+    class PalettedContainer {
+        public:
+            // Anchos soportados. Siempre potencias de 2 para que ningún índice cruce palabras
+            static constexpr int UNIFORM_BITS = 0;
+            static constexpr int MIN_BITS = 1;
+            static constexpr int MAX_BITS = 16;
+            // A partir de este tamaño de paleta la búsqueda lineal deja de compensar
+            static constexpr int LINEAR_PALETTE_LIMIT = 16;
+
+            explicit PalettedContainer(int size, BlockID fill = 0);
+
+            BlockID get(int index) const {
+                if(m_bits == UNIFORM_BITS){
+                    return m_uniformBlock;
+                }
+                return m_palette[readIndex(index)];
+            }
+            // Devuelve el bloque que había antes en la posición
+            BlockID set(int index, BlockID block);
+            // true si set(index, block) no va a realojar la paleta ni el array empaquetado
+            bool canSetInPlace(int index, BlockID block) const;
+
+            // Decodifica todos los vóxeles en orden de índice (out debe tener 'size' entradas).
+            // El contenedor no conoce el layout: para ChunkSection el índice es storageIndex()
+            void decode(BlockID* out) const;
+            // Reconstruye el contenedor a partir de un array denso de 'size' entradas
+            void encode(const BlockID* in);
+
+            // Reconstruye la paleta sin entradas muertas y reduce el ancho si es posible
+            void compact();
+            // Solo si compact() reduce de verdad: queda un único bloque (modo uniforme) o las entradas
+            // vivas caben en el ancho inferior dejando libre 1/4 de él (histéresis frente a crecer otra vez)
+            bool wantsCompact() const {
+                if(m_bits == UNIFORM_BITS){
+                    return false;
+                }
+                if(m_paletteLive == 1){
+                    return true;
+                }
+                if(m_bits == MIN_BITS){
+                    return false;
+                }
+                const int narrower = 1 << (m_bits >> 1);
+                return m_paletteLive <= narrower - (narrower > 2 ? narrower / 4 : 1);
+            }
+
+            // Vuelve al modo uniforme liberando el array
+            void fill(BlockID block);
+
+            bool isUniform() const { return m_bits == UNIFORM_BITS; }
+            BlockID getUniformBlock() const { return m_uniformBlock; }
+            int getBitsPerBlock() const { return m_bits; }
+            int getPaletteSize() const { return m_paletteLive; }
+            std::size_t getMemoryUsage() const;
+
+        private:
+            int findOrInsert(BlockID block);
+            void materialize();
+            void repack(int newBits);
+            void rebuildReverse();
+
+            uint32_t readIndex(int i) const {
+                const int perWordLog2 = 6 - m_bitsLog2;
+                const int shift = (i & ((1 << perWordLog2) - 1)) << m_bitsLog2;
+                return static_cast<uint32_t>(m_data[i >> perWordLog2] >> shift) & m_mask;
+            }
+            void writeIndex(int i, uint32_t value) {
+                const int perWordLog2 = 6 - m_bitsLog2;
+                const int shift = (i & ((1 << perWordLog2) - 1)) << m_bitsLog2;
+                uint64_t& word = m_data[i >> perWordLog2];
+                word = (word & ~(static_cast<uint64_t>(m_mask) << shift)) | (static_cast<uint64_t>(value) << shift);
+            }
+
+            int m_size;
+            int m_bits;
+            int m_bitsLog2;
+            uint32_t m_mask;
+            BlockID m_uniformBlock;              // Solo válido con m_bits == UNIFORM_BITS
+
+            std::vector<BlockID> m_palette;
+            std::vector<uint16_t> m_refCounts;   // Vóxeles que usan cada entrada (0 = hueco libre)
+            std::vector<uint16_t> m_freeSlots;   // Huecos reutilizables dentro de la paleta
+            int m_paletteLive;                   // Entradas con refCount > 0 (1 en modo uniforme)
+            std::vector<uint64_t> m_data;
+            // Índice inverso, solo para paletas grandes (ver LINEAR_PALETTE_LIMIT)
+            std::unordered_map<BlockID, uint16_t> m_reverse;
+    };
+}
+
+#endif // PALETTEDCONTAINER_H
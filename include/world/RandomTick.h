@@ -0,0 +1,103 @@
+#ifndef RANDOMTICK_H
+#define RANDOMTICK_H
+#include <vector>
+#include <functional>
+#include <cstdint>
+#include "World.h"
+#include "BlockRegistry.h"
+
+namespace AbyssCore {
+
+    // Posiciones aleatorias por tick y por cada RANDOM_TICK_VOLUME bloques (randomTickSpeed). Va por
+    // volumen y no por sección para que el ritmo por bloque no dependa de ABYSS_SECTION_SIZE_LOG2
+    constexpr int RANDOM_TICK_VOLUME = 4096;
+    constexpr int RANDOM_TICKS_PER_VOLUME = 3;
+
+    /**
+     * @class TickRandom
+     * @brief xorshift32 con LANES carriles independientes: cada paso produce LANES números.
+     *
+     * Con SSE2 un paso son dos vectores de 4 carriles; sin SSE2 el mismo cálculo en escalar.
+     * La calidad basta para elegir posiciones, no para nada criptográfico.
+     */
+    class TickRandom {
+        public:
+            static constexpr int LANES = 8;
+
+            explicit TickRandom(uint64_t seed);
+            // Escribe 'count' números en out; count debe ser múltiplo de LANES
+            void generate(uint32_t* out, int count);
+
+        private:
+            alignas(16) uint32_t m_state[LANES];
+    };
+
+    /**
+     * @class RandomTicker
+     * @brief Ticks aleatorios: RANDOM_TICKS_PER_VOLUME posiciones al azar por cada 4096 bloques y tick.
+     *
+     * Cada sección recibe speed * CHUNK_SECTION_VOLUME / 4096 sorteos por tick: 3 a 16^3, 24 a 32^3
+     * y 3/8 a 8^3. La parte fraccionaria se acumula entre ticks, así que a 8^3 todas las secciones
+     * reciben un sorteo en 3 de cada 8 ticks.
+     *
+     * Solo se muestrean secciones con ChunkSection::getTickableCount() > 0: en un mundo normal
+     * la mayoría (piedra, aire, agua) no tiene ningún bloque que lo necesite y no cuesta más que
+     * leer su contador. Las posiciones salen de un TickRandom por lotes.
+     *
+     * Los bloques elegidos se recogen primero y los handlers se llaman después, fuera del
+     * recorrido del mapa de columnas: un handler puede escribir en el mundo o crear secciones.
+     *
+     * @note Se llama desde el hilo de lógica, una vez por tick.
+     */
+    class RandomTicker {
+        public:
+            // random: bits aleatorios sobrantes del sorteo de la posición, para decisiones del handler
+            using Handler = std::function<void(int x, int y, int z, BlockID state, uint32_t random)>;
+
+            explicit RandomTicker(World& world, uint64_t seed = 0x9E3779B97F4A7C15ull);
+
+            // Un handler por tipo de bloque; los tipos sin handler se ignoran
+            void setHandler(BlockTypeID type, Handler handler);
+            // Sorteos por cada RANDOM_TICK_VOLUME bloques y tick
+            void setTickSpeed(int ticksPerVolume) { m_tickSpeed = ticksPerVolume; }
+            void tick();
+
+            // Estadísticas del último tick()
+            int getDrawsPerSection() const { return m_drawsPerSection; }
+            int getSectionsSampled() const { return m_sectionsSampled; }
+            int getBlocksTicked() const { return static_cast<int>(m_candidates.size()); }
+
+        private:
+            struct Candidate {
+                int x, y, z;
+                BlockID state;
+                uint32_t random;
+            };
+            static constexpr int DRAW_BATCH = 256;  // Múltiplo de TickRandom::LANES
+
+            uint32_t nextDraw(){
+                if(m_drawCursor == DRAW_BATCH){
+                    m_random.generate(m_draws, DRAW_BATCH);
+                    m_drawCursor = 0;
+                }
+                return m_draws[m_drawCursor++];
+            }
+            void sampleSection(const ChunkColumn* column, const ChunkSection* section);
+
+            World& m_world;
+            const BlockRegistry& m_registry;
+            std::vector<Handler> m_handlers;    // Por BlockTypeID
+            int m_tickSpeed;
+            int m_drawRemainder;        // En 1/RANDOM_TICK_VOLUME de sorteo, arrastrado entre ticks
+            int m_drawsPerSection;      // Del tick actual
+
+            TickRandom m_random;
+            alignas(16) uint32_t m_draws[DRAW_BATCH];
+            int m_drawCursor;
+
+            std::vector<Candidate> m_candidates;
+            int m_sectionsSampled;
+    };
+}
+
+#endif // RANDOMTICK_H
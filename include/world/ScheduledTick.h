@@ -0,0 +1,181 @@
+#ifndef SCHEDULEDTICK_H
+#define SCHEDULEDTICK_H
+#include <vector>
+#include <queue>
+#include <memory>
+#include <functional>
+#include <unordered_map>
+#include <cstdint>
+#include <cstddef>
+#include <utility>
+#include "World.h"
+
+namespace AbyssCore {
+
+    // Ticks programados que se ejecutan como máximo en un tick del juego (el resto espera al siguiente)
+    constexpr int SCHEDULED_TICK_BUDGET = 65536;
+
+    /**
+     * @class TickKeySet
+     * @brief Conjunto de claves con direccionamiento abierto y sondeo lineal (duplicados de TickScheduler).
+     *
+     * El borrado desplaza hacia atrás las entradas de la cadena, así que no hay lápidas y el
+     * conjunto no se degrada con el ir y venir de ticks.
+     */
+    class TickKeySet {
+        public:
+            // Hueco libre; ninguna clave de TickScheduler llega a este valor (los bits 26-31 quedan a 0)
+            static constexpr uint64_t EMPTY = UINT64_MAX;
+
+            bool insert(uint64_t key){
+                if((m_count + 1) * 4 > m_slots.size() * 3){
+                    grow();
+                }
+                std::size_t i = slotOf(key);
+                while(m_slots[i] != EMPTY){
+                    if(m_slots[i] == key){
+                        return false;
+                    }
+                    i = (i + 1) & (m_slots.size() - 1);
+                }
+                m_slots[i] = key;
+                m_count++;
+                return true;
+            }
+
+            bool contains(uint64_t key) const {
+                if(m_slots.empty()){
+                    return false;
+                }
+                for(std::size_t i = slotOf(key); m_slots[i] != EMPTY; i = (i + 1) & (m_slots.size() - 1)){
+                    if(m_slots[i] == key){
+                        return true;
+                    }
+                }
+                return false;
+            }
+
+            void erase(uint64_t key){
+                if(m_slots.empty()){
+                    return;
+                }
+                const std::size_t mask = m_slots.size() - 1;
+                std::size_t hole = slotOf(key);
+                while(m_slots[hole] != key){
+                    if(m_slots[hole] == EMPTY){
+                        return;
+                    }
+                    hole = (hole + 1) & mask;
+                }
+                // Las entradas siguientes que no pueden quedar antes de su posición ideal se mueven al hueco
+                for(std::size_t i = (hole + 1) & mask; m_slots[i] != EMPTY; i = (i + 1) & mask){
+                    const std::size_t ideal = slotOf(m_slots[i]);
+                    if(((i - ideal) & mask) >= ((i - hole) & mask)){
+                        m_slots[hole] = m_slots[i];
+                        hole = i;
+                    }
+                }
+                m_slots[hole] = EMPTY;
+                m_count--;
+            }
+
+            std::size_t size() const { return m_count; }
+
+        private:
+            std::size_t slotOf(uint64_t key) const {
+                return static_cast<std::size_t>((key * 0x9E3779B97F4A7C15ull) >> 32) & (m_slots.size() - 1);
+            }
+            void grow(){
+                std::vector<uint64_t> old = std::move(m_slots);
+                m_slots.assign(old.empty() ? 16 : old.size() * 2, EMPTY);
+                m_count = 0;
+                for(uint64_t key : old){
+                    if(key != EMPTY){
+                        insert(key);
+                    }
+                }
+            }
+
+            std::vector<uint64_t> m_slots;  // Potencia de 2
+            std::size_t m_count = 0;
+    };
+
+    /**
+     * @class TickScheduler
+     * @brief Ticks de bloque diferidos ("esta posición dentro de N ticks") agrupados por columna.
+     *
+     * Cada columna tiene su propio montículo por (tick de vencimiento, orden de llegada) y un
+     * conjunto plano de claves (posición, tipo) para descartar duplicados. Un montículo global de
+     * avisos, uno por columna con ticks pendientes, dice qué columna vence antes: su tamaño
+     * depende de las columnas, no de los millones de ticks.
+     *
+     * Descargar una columna suelta su bloque entero (dos vectores), sin buscar sus entradas en
+     * ninguna cola global; su aviso queda huérfano y se descarta al salir. Cada bloque guarda el
+     * ChunkColumn::loadId de la columna para la que se creó: si la columna se descarga sin pasar
+     * por dropColumn y se vuelve a cargar, sus ticks viejos se descartan en vez de correr sobre
+     * la columna nueva.
+     *
+     * @note Solo el hilo de lógica programa y ejecuta. Un tick programado desde un handler
+     *       nunca vence en el mismo tick (el retraso mínimo es 1).
+     */
+    class TickScheduler {
+        public:
+            using Handler = std::function<void(int x, int y, int z, BlockTypeID type)>;
+
+            explicit TickScheduler(World& world);
+            ~TickScheduler();
+
+            TickScheduler(const TickScheduler&) = delete;
+            TickScheduler& operator=(const TickScheduler&) = delete;
+
+            // Un handler por tipo de bloque; los ticks de tipos sin handler se descartan al vencer
+            void setHandler(BlockTypeID type, Handler handler);
+            void setBudget(int ticksPerTick) { m_budget = ticksPerTick; }
+
+            // Programa (x, y, z, type) para dentro de 'delay' ticks. false si ya estaba programado
+            // (se conserva el anterior) o si la columna no está cargada
+            bool schedule(int x, int y, int z, BlockTypeID type, int delay);
+            bool isScheduled(int x, int y, int z, BlockTypeID type) const;
+            // Olvida los ticks de una columna descargada
+            void dropColumn(int chunkX, int chunkZ);
+
+            // Avanza un tick del juego y ejecuta lo vencido hasta agotar el presupuesto
+            void tick();
+
+            uint64_t getCurrentTick() const { return m_currentTick; }
+            // Recorre las columnas con ticks (diagnóstico)
+            std::size_t getPendingCount() const;
+            // Ticks ejecutados en el último tick()
+            int getExecutedCount() const { return m_executed; }
+
+        private:
+            struct ColumnTicks;
+            // Columna que tiene su primer vencimiento en 'due'
+            struct Wakeup {
+                uint64_t due;
+                uint64_t columnKey;
+                bool operator>(const Wakeup& other) const { return due > other.due; }
+            };
+            struct DueTick {
+                int x, y, z;
+                BlockTypeID type;
+            };
+
+            void wake(ColumnTicks& column, uint64_t columnKey, uint64_t due);
+            // ChunkColumn::loadId de la columna cargada, 0 si no lo está
+            uint64_t loadIdOf(int chunkX, int chunkZ) const;
+
+            World& m_world;
+            std::vector<Handler> m_handlers;    // Por BlockTypeID
+            int m_budget;
+            uint64_t m_currentTick;
+            uint64_t m_sequence;                // Orden de llegada entre ticks del mismo vencimiento
+
+            std::unordered_map<uint64_t, std::unique_ptr<ColumnTicks>> m_columns;
+            std::priority_queue<Wakeup, std::vector<Wakeup>, std::greater<Wakeup>> m_wakeups;
+            std::vector<DueTick> m_due;         // Sacados de una columna, pendientes de su handler
+            int m_executed;
+    };
+}
+
+#endif // SCHEDULEDTICK_H
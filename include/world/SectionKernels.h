@@ -0,0 +1,37 @@
+#ifndef SECTIONKERNELS_H
+#define SECTIONKERNELS_H
+#include <cstdint>
+#include "BlockState.h"
+
+namespace AbyssCore {
+
+    /**
+     * Kernels de recorrido sobre arrays densos de bloques (p. ej. el resultado de ChunkSection::snapshot).
+     *
+     * Cada kernel tiene versión escalar, SSE4.1 y AVX2. La variante se elige una vez en tiempo de
+     * ejecución según la CPU, así que el binario no necesita compilarse con -mavx2.
+     */
+    namespace SectionKernels {
+
+        enum class Isa { Scalar, SSE41, AVX2 };
+
+        // Mejor conjunto de instrucciones soportado por la CPU
+        Isa detectIsa();
+        Isa getIsa();
+        // Fuerza una variante (benchmarks). Si la CPU no la soporta se usa la mejor disponible por debajo
+        void setIsa(Isa isa);
+        const char* isaName(Isa isa);
+
+        // Número de bloques distintos de aire
+        int countNonAir(const BlockID* blocks, int count);
+        // true si los 'count' bloques son iguales a blocks[0]
+        bool allEqual(const BlockID* blocks, int count);
+        // counts[id] += apariciones para id < numIds. Devuelve cuántos bloques quedaron fuera de rango
+        int histogram(const BlockID* blocks, int count, uint32_t* counts, BlockID numIds);
+        // Para una sección lineal (Y-Z-X) de size^3, la Y local más alta no aire por columna (x,z)
+        // en heights[z * size + x]; -1 si la columna está vacía
+        void highestNonAir(const BlockID* section, int size, int8_t* heights);
+    }
+}
+
+#endif // SECTIONKERNELS_H
@@ -0,0 +1,81 @@
+#ifndef SLABPOOL_H
+#define SLABPOOL_H
+#include <atomic>
+#include <mutex>
+#include <vector>
+#include <cstddef>
+
+namespace AbyssCore {
+
+    // Estadísticas de un pool: huecos en slabs reservados y cuántos están en uso
+    struct PoolStats {
+        std::size_t slotSize;
+        std::size_t slabs;
+        std::size_t capacity;   // Huecos totales
+        std::size_t live;       // Objetos vivos
+        std::size_t free;       // capacity - live (incluye los guardados en cachés de hilo)
+    };
+
+    /**
+     * @class SlabPool
+     * @brief Allocator de objetos de tamaño fijo en slabs grandes con listas libres por hilo.
+     *
+     * Cada hilo guarda una pequeña lista de huecos libres propia y solo toca la lista global
+     * (con mutex) para recargar o devolver lotes de BATCH huecos, así que las rachas de
+     * carga/descarga de chunks no compiten por el allocator general. Los slabs no se devuelven
+     * al sistema: tras un pico se reutilizan, lo que evita fragmentación en servidores de larga duración.
+     *
+     * Con ABYSS_POOL_HUGE_PAGES los slabs son de 2 MB alineados y se marcan con MADV_HUGEPAGE.
+     *
+     * @note Thread-Safe. Los pools nunca se destruyen: puede haber objetos estáticos que se liberen tarde.
+     */
+    class SlabPool {
+        public:
+            // Pools distintos que admite la caché por hilo
+            static constexpr int MAX_POOLS = 8;
+            // Huecos que se mueven de una vez entre la lista global y la de un hilo
+            static constexpr int BATCH = 32;
+#ifdef ABYSS_POOL_HUGE_PAGES
+            static constexpr std::size_t SLAB_BYTES = 2 * 1024 * 1024;
+#else
+            static constexpr std::size_t SLAB_BYTES = 64 * 1024;
+#endif
+
+            SlabPool(const char* name, std::size_t slotSize, std::size_t alignment);
+
+            SlabPool(const SlabPool&) = delete;
+            SlabPool& operator=(const SlabPool&) = delete;
+
+            void* allocate();
+            void deallocate(void* ptr);
+
+            PoolStats getStats() const;
+            const char* getName() const { return m_name; }
+
+        private:
+            struct FreeNode {
+                FreeNode* next;
+            };
+            struct ThreadCache;
+
+            // Devuelve hasta BATCH huecos de la lista global, creando un slab si está vacía
+            FreeNode* takeBatch(int& count);
+            void releaseList(FreeNode* head, FreeNode* tail);
+            void allocateSlab();
+
+            static thread_local ThreadCache s_threadCaches[MAX_POOLS];
+
+            const char* m_name;
+            int m_id;
+            std::size_t m_slotSize;
+            std::size_t m_alignment;
+
+            mutable std::mutex m_mutex;
+            FreeNode* m_freeList;
+            std::vector<void*> m_slabs;
+            std::size_t m_capacity;
+            std::atomic<std::size_t> m_live;
+    };
+}
+
+#endif // SLABPOOL_H
@@ -0,0 +1,73 @@
+#ifndef VOXELLAYOUT_H
+#define VOXELLAYOUT_H
+#include <array>
+#include <cstdint>
+#if defined(__BMI2__)
+#include <immintrin.h>
+#endif
+
+namespace AbyssCore {
+
+    /**
+     * Orden Morton (curva Z) para cubos de hasta 32^3: los bits de x, z e y se intercalan
+     * (x en los bits 0, 3, 6..., z en 1, 4, 7..., y en 2, 5, 8...), de modo que cada
+     * sub-cubo de 2^k de lado ocupa un tramo contiguo del array.
+     *
+     * Codificar es una consulta a tabla por eje. Con BMI2 disponible en compilación
+     * (-mbmi2 o -march=native) se usan pdep/pext; no hay selección en ejecución porque
+     * la codificación va inlineada en getBlock().
+     */
+    namespace Morton {
+        constexpr int MAX_AXIS_BITS = 5;
+        constexpr uint32_t X_MASK = 0x1249u;  // Bits 0, 3, 6, 9, 12
+        constexpr uint32_t Z_MASK = X_MASK << 1;
+        constexpr uint32_t Y_MASK = X_MASK << 2;
+
+        // spread(v): bit i de v en el bit 3i
+        constexpr uint32_t spread(uint32_t v){
+            uint32_t out = 0;
+            for(int i = 0; i < MAX_AXIS_BITS; i++){
+                out |= ((v >> i) & 1u) << (3 * i);
+            }
+            return out;
+        }
+
+        constexpr std::array<uint16_t, 1 << MAX_AXIS_BITS> makeSpreadTable(){
+            std::array<uint16_t, 1 << MAX_AXIS_BITS> table{};
+            for(uint32_t v = 0; v < table.size(); v++){
+                table[v] = static_cast<uint16_t>(spread(v));
+            }
+            return table;
+        }
+        inline constexpr std::array<uint16_t, 1 << MAX_AXIS_BITS> SPREAD = makeSpreadTable();
+
+        inline int encode(int x, int y, int z){
+#if defined(__BMI2__)
+            return static_cast<int>(_pdep_u32(x, X_MASK) | _pdep_u32(z, Z_MASK) | _pdep_u32(y, Y_MASK));
+#else
+            return SPREAD[x] | (SPREAD[z] << 1) | (SPREAD[y] << 2);
+#endif
+        }
+
+        // Inversa de spread: recoge los bits 0, 3, 6... de v
+        inline int compact(uint32_t v){
+#if defined(__BMI2__)
+            return static_cast<int>(_pext_u32(v, X_MASK));
+#else
+            v &= X_MASK;
+            v = (v | (v >> 2)) & 0x10C3u;   // Pares de bits separados 6
+            v = (v | (v >> 4)) & 0x100Fu;   // Bits 0-3 juntos, el 12 suelto
+            v = (v | (v >> 8)) & 0x1Fu;
+            return static_cast<int>(v);
+#endif
+        }
+
+        inline void decode(int index, int& x, int& y, int& z){
+            x = compact(static_cast<uint32_t>(index));
+            z = compact(static_cast<uint32_t>(index) >> 1);
+            y = compact(static_cast<uint32_t>(index) >> 2);
+        }
+    }
+}
+
+#endif // VOXELLAYOUT_H
@@ -0,0 +1,84 @@
+#ifndef WORLD_H
+#define WORLD_H
+#include <memory>
+#include <mutex>
+#include <vector>
+#include <atomic>
+#include <climits>
+#include <cstddef>
+#include "ChunkColumn.h"
+#include "ColumnMap.h"
+#include "ChangeQueue.h"
+#include "utils/MemoryStats.h"
+
+namespace AbyssCore {
+
+    /**
+     * @class World
+     * @brief Contenedor de todas las columnas cargadas, indexadas por (chunkX, chunkZ).
+     *
+     * Las lecturas (getColumn, getBlock) no bloquean y pueden hacerse desde cualquier hilo.
+     * Cargar y descargar columnas es seguro durante el streaming: una columna descargada
+     * desaparece del mapa al instante y EpochManager la libera cuando ningún hilo con un
+     * EpochGuard abierto puede tener todavía su puntero.
+     *
+     * @note Los punteros que devuelven getColumn/getOrCreateColumn solo son válidos dentro de un EpochGuard.
+     */
+    class World {
+        public:
+            World() = default;
+            ~World();
+
+            World(const World&) = delete;
+            World& operator=(const World&) = delete;
+
+            // Conversión de coordenadas mundiales a columna + coordenadas locales
+            static int toChunkCoord(int worldCoord) { return worldCoord >> CHUNK_SECTION_SIZE_LOG2; }
+            static int toLocalCoord(int worldCoord) { return worldCoord & CHUNK_SECTION_MASK; }
+
+            // Búsqueda sin lock, nullptr si la columna no está cargada
+            ChunkColumn* getColumn(int chunkX, int chunkZ) const {
+                EpochGuard guard;
+                return m_columns.find(packColumnKey(chunkX, chunkZ));
+            }
+            ChunkColumn* getOrCreateColumn(int chunkX, int chunkZ);
+            // Quita la columna del mapa y la retira por épocas. Devuelve false si no estaba cargada
+            bool unloadColumn(int chunkX, int chunkZ);
+
+            // Coordenadas mundiales. Una columna no cargada se lee como aire
+            BlockID getBlock(int x, int y, int z) const;
+            // Crea la columna si hace falta (salvo para poner aire)
+            void setBlock(int x, int y, int z, BlockID block);
+
+            std::size_t getColumnCount() const { return m_columns.size(); }
+            // Caja (en columnas) que contiene todas las columnas que se han llegado a cargar. Solo crece:
+            // descargar no la reduce, así que fuera de ella seguro que no hay columna. false si nunca hubo
+            bool getColumnBounds(int& minChunkX, int& minChunkZ, int& maxChunkX, int& maxChunkZ) const;
+
+            // Recorre las columnas cargadas sin bloquear
+            template <typename Fn>
+            void forEachColumn(Fn fn) const {
+                EpochGuard guard;
+                m_columns.forEach(fn);
+            }
+
+            // Secciones modificadas desde la última llamada, una entrada por sección.
+            // Pensado para llamarse una vez por tick desde el hilo de lógica
+            void drainChanges(std::vector<SectionChange>& out);
+
+            // Suma al informe la memoria de secciones y columnas (recorre todo el mundo)
+            void accountMemory(MemoryReport& report) const;
+
+        private:
+            void growBounds(int chunkX, int chunkZ);
+
+            ColumnMap m_columns;
+            ChangeQueue m_changes;
+            std::atomic<int> m_minChunkX{INT_MAX};
+            std::atomic<int> m_minChunkZ{INT_MAX};
+            std::atomic<int> m_maxChunkX{INT_MIN};
+            std::atomic<int> m_maxChunkZ{INT_MIN};
+    };
+}
+
+#endif // WORLD_H
@@ -1,10 +1,22 @@
 #include "core/Game.h"
+#include <algorithm>
 
 
 namespace AbyssCore {
     Game::Game() : m_isRunning(true){
         m_window = std::make_unique<Window>(800,600,"AbyssCraft");
         m_shader = std::make_unique<Shader>("assets/shaders/core.vert", "assets/shaders/core.frag");
+        // Antes que el mundo y sus sistemas: luz, ticks y fluidos leen las tablas del registro.
+        // TextureManager aún no está en el juego, así que todas las caras usan la capa 0
+        BlockRegistry::getInstance().init([](const std::string&){ return 0; });
+        m_world = std::make_unique<World>();
+        // Los hilos de render y de lógica ya ocupan dos núcleos
+        const int cores = static_cast<int>(std::thread::hardware_concurrency());
+        m_lightScheduler = std::make_unique<LightScheduler>(*m_world, std::max(0, cores - 2));
+        m_randomTicker = std::make_unique<RandomTicker>(*m_world);
+        m_tickScheduler = std::make_unique<TickScheduler>(*m_world);
+        m_fluids = std::make_unique<FluidSimulation>(*m_world, std::max(0, cores - 2));
+        registerRandomTicks();
     }
 
     Game::~Game(){
@@ -13,6 +25,45 @@ namespace AbyssCore {
             m_logicThread.join(); // Esperamos a que el hilo de logica termine antes de cerrar, para no dejar hijos en el SO
             std::cout << "[System] Logic thread joined safely." << std::endl;
         }
+        logMemoryUsage();
+    }
+
+    /**
+     * @brief Comportamiento de los bloques con tick aleatorio.
+     *
+     * - Hierba: se apaga a tierra si la tapa un bloque opaco; si no, se extiende a un bloque de
+     *   tierra al azar del cubo 3x3x3 que la rodea si no tiene un bloque opaco encima.
+     */
+    void Game::registerRandomTicks(){
+        m_randomTicker->setHandler(BLOCK_GRASS, [this](int x, int y, int z, BlockID, uint32_t random){
+            const BlockRegistry& registry = BlockRegistry::getInstance();
+            const BlockID dirt = registry.getBaseState(BLOCK_DIRT);
+            if(registry.getLightOpacity(m_world->getBlock(x, y + 1, z)) == LIGHT_MAX){
+                m_lightScheduler->setBlock(x, y, z, dirt);
+                return;
+            }
+            const int tx = x + static_cast<int>(random % 3) - 1;
+            const int ty = y + static_cast<int>(random / 3 % 3) - 1;
+            const int tz = z + static_cast<int>(random / 9 % 3) - 1;
+            if(m_world->getBlock(tx, ty, tz) == dirt && registry.getLightOpacity(m_world->getBlock(tx, ty + 1, tz)) < LIGHT_MAX){
+                m_lightScheduler->setBlock(tx, ty, tz, registry.getBaseState(BLOCK_GRASS));
+            }
+        });
+    }
+
+    /**
+     * @brief Muestra por consola la memoria usada por cada subsistema.
+     *
+     * @note Recorre el mundo entero; pensado para diagnóstico, no para cada frame.
+     */
+    void Game::logMemoryUsage() const {
+        MemoryReport report = MemoryStats::getInstance().collect();
+        m_world->accountMemory(report);
+        for(int category = 0; category < MEMORY_CATEGORY_COUNT; category++){
+            std::cout << "[Memory] " << MemoryStats::categoryName(static_cast<MemoryCategory>(category))
+                      << ": " << report.bytes[category] / 1024 << " KB" << std::endl;
+        }
+        std::cout << "[Memory] total: " << report.total() / 1024 << " KB" << std::endl;
     }
 
     void Game::run(){
@@ -82,10 +133,20 @@ namespace AbyssCore {
                     if(m_triangleX >0.8f || m_triangleX < -0.8f){
                         m_triangleSpeed *= -1.0f; // Rebote
                     }
-                    // world->tick();
                     // player->tick();
                     // physics->update();
                 }
+                // Ticks del mundo: pueden cambiar bloques, así que van antes de la luz
+                m_randomTicker->tick();
+                m_tickScheduler->tick();
+                m_fluids->tick();
+                for(const FluidChange& change : m_fluids->getChanges()){
+                    m_lightScheduler->onBlockChanged(change.x, change.y, change.z, change.oldBlock, change.newBlock);
+                }
+                // Cambios de luz acumulados durante el tick
+                m_lightScheduler->update();
+                // Libera lo que el mundo retiró hace al menos dos épocas (columnas descargadas, tablas...)
+                EpochManager::getInstance().collect();
                 // --- Fin sección critica
                 delta -= nsPerTick;
 
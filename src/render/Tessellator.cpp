@@ -1,4 +1,5 @@
 #include "render/Tessellator.h"
+#include "utils/MemoryStats.h"
 #include <iostream>
 #include <cstddef>
 
@@ -35,6 +36,8 @@ namespace AbyssCore {
     {
         m_buffer.reserve(m_maxVertices);
         initRednderData();
+        // Búfer en CPU + VBO del mismo tamaño en GPU
+        MemoryStats::getInstance().add(MEMORY_MESHES, 2 * m_maxVertices * sizeof(Vertex));
     }
     
     /**
@@ -48,6 +51,7 @@ namespace AbyssCore {
     Tessellator::~Tessellator() {
         glDeleteVertexArrays(1, &VAO);
         glDeleteBuffers(1, &VBO);
+        MemoryStats::getInstance().remove(MEMORY_MESHES, 2 * m_maxVertices * sizeof(Vertex));
     }
     
     /**
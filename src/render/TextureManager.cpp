@@ -1,4 +1,5 @@
 #include "render/TextureManager.h"
+#include "utils/MemoryStats.h"
 
 #include <stb/stb_image.h>
 #include <iostream>
@@ -15,7 +16,8 @@ namespace AbyssCore {
         // NOTA: Esto mas adelante lo cogeremos del sistema
         std::vector<std::string> textures = {
             "stone", "dirt", "grass", "grass_side", 
-            "coal_ore", "iron_ore", "log", "log_top", "leaves"
+            "coal_ore", "iron_ore", "log", "log_top", "leaves",
+            "water", "lamp", "lava"
         };
 
         //Creación del texture array
@@ -23,6 +25,12 @@ namespace AbyssCore {
         glBindTexture(GL_TEXTURE_2D_ARRAY,m_textureID);
         //Reserva de memoria
         glTexImage3D(GL_TEXTURE_2D_ARRAY, 0, GL_RGBA8, TEXTURE_WIDTH, TEXTURE_HEIGHT, textures.size(), 0, GL_RGBA, GL_UNSIGNED_BYTE, nullptr);
+        // RGBA8 por capa, más 1/3 para la cadena de mipmaps
+        MemoryStats::getInstance().add(MEMORY_TEXTURES, TEXTURE_WIDTH * TEXTURE_HEIGHT * 4 * textures.size() * 4 / 3);
+
+        // Internamos los nombres: capa i = textures[i]. Las que fallan no entran en el mapa y resuelven a 0
+        m_textureMap.clear();
+        m_textureNames = textures;
 
         // Cargamos imagen oor imagen
         for (int i = 0; i < textures.size(); i++){
@@ -32,7 +40,7 @@ namespace AbyssCore {
             if(data){
                 glTexSubImage3D(GL_TEXTURE_2D_ARRAY, 0, 0, 0, i, width, height, 1, GL_RGBA, GL_UNSIGNED_BYTE, data);
             
-                m_textureMap[textures[i]] = i;
+                m_textureMap.emplace(textures[i], static_cast<uint16_t>(i));
                 stbi_image_free(data);
             }else{
                 std::cerr << "Failed to load texture: " << path << std::endl;
@@ -48,9 +56,11 @@ namespace AbyssCore {
         glGenerateMipmap(GL_TEXTURE_2D_ARRAY);
     }
 
-    int TextureManager::getTextureLayer(const std::string& name){
-        if(m_textureMap.find(name) != m_textureMap.end()){
-            return m_textureMap[name];  // Recogemos la textura correcta
+    int TextureManager::getTextureLayer(const std::string& name) const {
+        // Una sola búsqueda en el hash
+        std::unordered_map<std::string,uint16_t>::const_iterator it = m_textureMap.find(name);
+        if(it != m_textureMap.end()){
+            return it->second;  // Recogemos la textura correcta
         }
         return 0; // Devolvemos el bloque default (stone)
     }
@@ -0,0 +1,29 @@
+#include "utils/MemoryStats.h"
+
+namespace AbyssCore {
+
+    MemoryStats::MemoryStats(){
+        for(std::atomic<std::size_t>& bytes : m_bytes){
+            bytes.store(0, std::memory_order_relaxed);
+        }
+    }
+
+    MemoryReport MemoryStats::collect() const {
+        MemoryReport report;
+        for(int category = 0; category < MEMORY_CATEGORY_COUNT; category++){
+            report.bytes[category] = get(static_cast<MemoryCategory>(category));
+        }
+        return report;
+    }
+
+    const char* MemoryStats::categoryName(MemoryCategory category){
+        switch(category){
+            case MEMORY_SECTIONS: return "sections";
+            case MEMORY_COLUMNS:  return "columns";
+            case MEMORY_MESHES:   return "meshes";
+            case MEMORY_TEXTURES: return "textures";
+            case MEMORY_POOLS:    return "pools";
+            default:              return "unknown";
+        }
+    }
+}
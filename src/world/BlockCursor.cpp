@@ -0,0 +1,114 @@
+#include "world/BlockCursor.h"
+
+namespace AbyssCore {
+
+    BlockCursor::BlockCursor(const World& world)
+    : BlockCursor(world, 0, 0, 0) {}
+
+    BlockCursor::BlockCursor(const World& world, int x, int y, int z)
+    : m_world(world),
+      m_x(x), m_y(y), m_z(z),
+      m_chunkX(0), m_chunkZ(0), m_sectionY(0),
+      m_column(nullptr),
+      m_section(nullptr),
+      m_resolvedMask(0) {
+        m_column = m_world.getColumn(World::toChunkCoord(x), World::toChunkCoord(z));
+        m_chunkX = World::toChunkCoord(x);
+        m_chunkZ = World::toChunkCoord(z);
+        resolve();
+    }
+
+    void BlockCursor::moveTo(int x, int y, int z){
+        m_x = x;
+        m_y = y;
+        m_z = z;
+        resolve();
+    }
+
+    /**
+     * @brief Recalcula coordenadas locales y, si ha cambiado, la columna y la sección actuales.
+     *
+     * @note Al cambiar de sección se invalida la caché de vecinas.
+     */
+    void BlockCursor::resolve(){
+        m_localX = World::toLocalCoord(m_x);
+        m_localY = m_y & CHUNK_SECTION_MASK;
+        m_localZ = World::toLocalCoord(m_z);
+
+        const int chunkX = World::toChunkCoord(m_x);
+        const int chunkZ = World::toChunkCoord(m_z);
+        const int sectionY = m_y >> CHUNK_SECTION_SIZE_LOG2;
+        const bool sameColumn = (chunkX == m_chunkX && chunkZ == m_chunkZ);
+        if(sameColumn && sectionY == m_sectionY && m_resolvedMask != 0){
+            return;
+        }
+        if(!sameColumn){
+            m_column = m_world.getColumn(chunkX, chunkZ);
+            m_chunkX = chunkX;
+            m_chunkZ = chunkZ;
+        }
+        m_sectionY = sectionY;
+        m_section = (m_column != nullptr) ? m_column->findSection(sectionY) : nullptr;
+
+        m_resolvedMask = 1u << 13; // El centro (0,0,0) ya está resuelto
+        m_neighbors[13] = m_section;
+    }
+
+    /**
+     * @brief Devuelve una sección vecina (-1..1 en cada eje) resolviéndola solo la primera vez.
+     */
+    const ChunkSection* BlockCursor::neighborSection(int sx, int sy, int sz) const {
+        const int slot = (sy + 1) * 9 + (sz + 1) * 3 + (sx + 1);
+        if(m_resolvedMask & (1u << slot)){
+            return m_neighbors[slot];
+        }
+        const ChunkColumn* column = m_column;
+        if(sx != 0 || sz != 0){
+            column = m_world.getColumn(m_chunkX + sx, m_chunkZ + sz);
+        }
+        const ChunkSection* section = (column != nullptr) ? column->findSection(m_sectionY + sy) : nullptr;
+        m_neighbors[slot] = section;
+        m_resolvedMask |= 1u << slot;
+        return section;
+    }
+
+    /**
+     * @brief Lectura fuera de la sección actual.
+     *
+     * @param lx Coordenada local X (puede salirse de [0, 15]).
+     * @note Con desplazamientos de hasta 16 bloques se usa la caché de vecinas; más lejos, el mundo.
+     */
+    BlockID BlockCursor::getRelativeSlow(int lx, int ly, int lz) const {
+        const int sx = lx >> CHUNK_SECTION_SIZE_LOG2;
+        const int sy = ly >> CHUNK_SECTION_SIZE_LOG2;
+        const int sz = lz >> CHUNK_SECTION_SIZE_LOG2;
+        if(sx < -1 || sx > 1 || sy < -1 || sy > 1 || sz < -1 || sz > 1){
+            return m_world.getBlock(m_x + lx - m_localX, m_y + ly - m_localY, m_z + lz - m_localZ);
+        }
+        const ChunkSection* section = neighborSection(sx, sy, sz);
+        if(section == nullptr){
+            return 0;
+        }
+        return section->getBlock(lx & CHUNK_SECTION_MASK, ly & CHUNK_SECTION_MASK, lz & CHUNK_SECTION_MASK);
+    }
+
+    void BlockCursor::getFaceNeighbors(BlockID out[6]) const {
+        for(int face = 0; face < 6; face++){
+            out[face] = getRelative(FACE_OFFSETS[face][0], FACE_OFFSETS[face][1], FACE_OFFSETS[face][2]);
+        }
+    }
+
+    void BlockCursor::getNeighbors26(BlockID out[26]) const {
+        int n = 0;
+        for(int dy = -1; dy <= 1; dy++){
+            for(int dz = -1; dz <= 1; dz++){
+                for(int dx = -1; dx <= 1; dx++){
+                    if(dx == 0 && dy == 0 && dz == 0){
+                        continue;
+                    }
+                    out[n++] = getRelative(dx, dy, dz);
+                }
+            }
+        }
+    }
+}
@@ -1,59 +1,148 @@
 #include "world/BlockRegistry.h"
-#include "render/TextureManager.h"
+#include <stdexcept>
+#include <cstring>
 
 namespace AbyssCore {
 
-    void BlockRegistry::init(){
-        
-        // ID 0 : Air
-        TextureManager& tex = TextureManager::getInstance();
-        m_blocks.push_back({
-            "Air",0,0,0,true
-        });
-
-        // ID 1 : Stone
-        int stoneTex = tex.getTextureLayer("dirt");
-        m_blocks.push_back({
-            "Stone",stoneTex,stoneTex,stoneTex,false
-        });
-
-        // ID 2 : Dirt
-        int dirtTex = tex.getTextureLayer("dirt");
-        m_blocks.push_back({
-            "Dirt",dirtTex,dirtTex,dirtTex,false
-        });
-
-        // ID 3 : Grass
-        int grassTopTex = tex.getTextureLayer("grass");
-        int grassSideTex = tex.getTextureLayer("grass_side");
-        m_blocks.push_back({
-            "Grass",grassTopTex,grassSideTex,dirtTex,false
-        });
-
-        // ID 4 : Log
-        int log_topTex = tex.getTextureLayer("log_top");
-        int logTex = tex.getTextureLayer("log");
-        m_blocks.push_back({
-            "Log",log_topTex,logTex,log_topTex,false
-        });
-
-        // ID 5 : Leaves
-        int leavesTex = tex.getTextureLayer("leaves");
-        m_blocks.push_back({
-            "Leaves",leavesTex,leavesTex,leavesTex,true
-        });
-
-        int coalTex = tex.getTextureLayer("coal_ore");
-        m_blocks.push_back({
-            "Coal",coalTex,coalTex,coalTex,false
-        });
-
-        int ironTex = tex.getTextureLayer("iron_ore");
-        m_blocks.push_back({
-            "Iron",ironTex,ironTex,ironTex,false
-        });
+    /**
+     * @brief Registra los bloques del juego en orden de BlockTypes.
+     *
+     * @param textureLayer Resuelve nombres de textura a capas (p. ej. TextureManager::getTextureLayer).
+     * @note Llamar una sola vez; en servidores o benchmarks basta un resolver que devuelva 0.
+     *       Cada nombre se resuelve una única vez aquí; después solo se consulta la tabla de caras.
+     */
+    void BlockRegistry::init(const TextureResolver& textureLayer){
+        m_blocks.clear();
+        m_stateTypes.clear();
+        m_stateCount = 0;
+        m_transparent.clear();
+        m_lightOpacity.clear();
+        m_lightEmission.clear();
+        m_collision.clear();
+        m_ticksRandomly.clear();
+        m_faceTextures.clear();
+
+        // Estado 0 : Air
+        registerBlock({"Air",0,0,0,true,0,0,SHAPE_EMPTY});
+
+        // Estado 1 : Stone
+        int stoneTex = textureLayer("stone");
+        registerBlock({"Stone",stoneTex,stoneTex,stoneTex,false});
+
+        // Estado 2 : Dirt
+        int dirtTex = textureLayer("dirt");
+        registerBlock({"Dirt",dirtTex,dirtTex,dirtTex,false});
+
+        // Estado 3 : Grass
+        int grassTopTex = textureLayer("grass");
+        int grassSideTex = textureLayer("grass_side");
+        registerBlock({"Grass",grassTopTex,grassSideTex,dirtTex,false,LIGHT_MAX,0,SHAPE_FULL_CUBE,true});
+
+        // Estados 4-7 : Log (eje del tronco)
+        int log_topTex = textureLayer("log_top");
+        int logTex = textureLayer("log");
+        registerBlock({"Log",log_topTex,logTex,log_topTex,false}, {BlockProperties::AXIS});
+
+        // Estado 8 : Leaves
+        int leavesTex = textureLayer("leaves");
+        registerBlock({"Leaves",leavesTex,leavesTex,leavesTex,true,1});
+
+        int coalTex = textureLayer("coal_ore");
+        registerBlock({"Coal",coalTex,coalTex,coalTex,false});
+
+        int ironTex = textureLayer("iron_ore");
+        registerBlock({"Iron",ironTex,ironTex,ironTex,false});
+
+        // Estados 11-26 : Water (nivel + cayendo)
+        int waterTex = textureLayer("water");
+        registerBlock({"Water",waterTex,waterTex,waterTex,true,2,0,SHAPE_EMPTY}, {BlockProperties::LEVEL, BlockProperties::FALLING});
+
+        // Estado 27 : Lamp (fuente de luz de bloque)
+        int lampTex = textureLayer("lamp");
+        registerBlock({"Lamp",lampTex,lampTex,lampTex,false,LIGHT_MAX,LIGHT_MAX});
+
+        // Estados 28-43 : Lava (nivel + cayendo, como el agua); emite luz
+        int lavaTex = textureLayer("lava");
+        registerBlock({"Lava",lavaTex,lavaTex,lavaTex,false,LIGHT_MAX,LIGHT_MAX,SHAPE_EMPTY}, {BlockProperties::LEVEL, BlockProperties::FALLING});
     }
 
-    //    const BlockType& BlockRegistry
+    /**
+     * @brief Registra un tipo de bloque y reserva sus estados.
+     *
+     * @param type Definición (nombre, texturas, transparencia).
+     * @param properties Propiedades del tipo; sus campos de bits no pueden solaparse.
+     * @return BlockID Primer estado del tipo (todas las propiedades a 0).
+     * @note Los estados son consecutivos entre tipos: un bloque sin propiedades ocupa un único ID.
+     *       Registrar crece las tablas por estado: no hacerlo mientras otros hilos las consultan.
+     */
+    BlockID BlockRegistry::registerBlock(BlockType type, std::initializer_list<BlockProperty> properties){
+        uint32_t usedBits = 0;
+        int stateBits = 0;
+        for(const BlockProperty& property : properties){
+            const uint32_t bits = property.mask() << property.shift;
+            if(usedBits & bits){
+                throw std::invalid_argument("BlockRegistry: overlapping properties in " + type.name);
+            }
+            usedBits |= bits;
+            stateBits = (property.end() > stateBits) ? property.end() : stateBits;
+        }
+
+        type.properties.assign(properties.begin(), properties.end());
+        type.baseState = m_stateCount;
+        type.stateCount = 1u << stateBits;
+        m_stateCount += type.stateCount;
+
+        // Tablas por estado: todos los estados del tipo comparten atributos
+        m_stateTypes.insert(m_stateTypes.end(), type.stateCount, static_cast<BlockTypeID>(m_blocks.size()));
+        m_transparent.insert(m_transparent.end(), type.stateCount, type.isTransparent ? 1 : 0);
+        m_lightOpacity.insert(m_lightOpacity.end(), type.stateCount, type.lightOpacity);
+        m_lightEmission.insert(m_lightEmission.end(), type.stateCount, type.lightEmission);
+        m_collision.insert(m_collision.end(), type.stateCount, type.collision);
+        m_ticksRandomly.insert(m_ticksRandomly.end(), type.stateCount, type.ticksRandomly ? 1 : 0);
+        // Solo la orientación cambia qué textura lleva cada cara
+        const BlockProperty* axis = nullptr;
+        for(const BlockProperty& property : type.properties){
+            if(std::strcmp(property.name, BlockProperties::AXIS.name) == 0){
+                axis = &property;
+            }
+        }
+        for(uint32_t offset = 0; offset < type.stateCount; offset++){
+            m_faceTextures.push_back(resolveFaces(type, axis ? axis->get(offset) : 0));
+        }
+
+        m_blocks.push_back(std::move(type));
+        return m_blocks.back().baseState;
+    }
+
+    /**
+     * @brief Capas de textura de las seis caras de un estado.
+     *
+     * @param type Tipo con sus texturas superior, lateral e inferior.
+     * @param axis Eje del bloque (AXIS): 0 = Y, 1 = X, 2 = Z. Las tapas van en las caras de ese eje.
+     * @return std::array<uint16_t, FACE_COUNT> Capa por cara en orden BlockFace.
+     */
+    std::array<uint16_t, FACE_COUNT> BlockRegistry::resolveFaces(const BlockType& type, uint32_t axis){
+        std::array<uint16_t, FACE_COUNT> faces;
+        faces.fill(static_cast<uint16_t>(type.textureSide));
+        // Caras negativa y positiva del eje: -X/+X, -Y/+Y o -Z/+Z
+        const int axisFace = (axis == 1) ? FACE_NEG_X : (axis == 2) ? FACE_NEG_Z : FACE_NEG_Y;
+        faces[axisFace] = static_cast<uint16_t>(type.textureBottom);
+        faces[axisFace + 1] = static_cast<uint16_t>(type.textureTop);
+        return faces;
+    }
+
+    /**
+     * @brief Devuelve la definición del tipo de un estado.
+     *
+     * @param state ID de estado.
+     * @return const BlockType& Definición; un bloque opaco "Unknown" si el estado no está registrado.
+     */
+    const BlockType& BlockRegistry::getBlock(BlockID state) const {
+        if(state < m_stateTypes.size()){
+            return m_blocks[m_stateTypes[state]];
+        }
+        static const BlockType unknown = {"Unknown", 0, 0, 0, false};
+        return unknown;
+    }
 
-}
\ No newline at end of file
+}
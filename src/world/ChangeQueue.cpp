@@ -0,0 +1,25 @@
+#include "world/ChangeQueue.h"
+
+namespace AbyssCore {
+
+    void ChangeQueue::push(const SectionChange& change){
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending.push_back(change);
+    }
+
+    /**
+     * @brief Entrega las notificaciones acumuladas.
+     *
+     * @param out Vector destino; se intercambia con el interno para reutilizar su capacidad.
+     */
+    void ChangeQueue::drain(std::vector<SectionChange>& out){
+        out.clear();
+        std::lock_guard<std::mutex> lock(m_mutex);
+        m_pending.swap(out);
+    }
+
+    std::size_t ChangeQueue::size() const {
+        std::lock_guard<std::mutex> lock(m_mutex);
+        return m_pending.size();
+    }
+}
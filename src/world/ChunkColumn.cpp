@@ -1,32 +1,191 @@
 #include "world/ChunkColumn.h"
+#include "world/BlockRegistry.h"
+#include "world/SectionKernels.h"
+#include <algorithm>
+#include <climits>
 
 namespace AbyssCore {
     // Definiciones
-    using SectionIterator = std::unordered_map<int, std::unique_ptr<ChunkSection>>::iterator;
-    //Unique ptr nos garantiza que un solo objeto sea dueño de la
-    //  sección del chunk e memoria. Además de liberarse de la memoria
-    //  de forma automatica.
-    using SectionPtr = std::unique_ptr<ChunkSection>;
+    // Altura inicial de la tabla (en secciones): cubre un mundo clásico de -64 a 320 bloques
+    constexpr int INITIAL_TABLE_MIN_Y = -64 / CHUNK_SECTION_SIZE;
+    constexpr int INITIAL_TABLE_CAPACITY = 384 / CHUNK_SECTION_SIZE;
     
     
-    ChunkColumn::ChunkColumn(int x, int z) : x(x),z(z){}
+    static std::atomic<uint64_t> nextLoadId(1);
+
+    ChunkColumn::ChunkColumn(int x, int z, ChangeQueue* changes)
+    : x(x), z(z),
+      loadId(nextLoadId.fetch_add(1, std::memory_order_relaxed)),
+      m_changes(changes),
+      m_table(nullptr),
+      m_lightReady(false),
+      m_minSectionY(INT_MAX),
+      m_maxSectionY(INT_MIN) {
+        for(std::array<std::atomic<int>, CHUNK_SECTION_LAYER>& heightmap : m_heightmaps){
+            for(std::atomic<int>& height : heightmap){
+                height.store(HEIGHT_NONE, std::memory_order_relaxed);
+            }
+        }
+    }
+
+    SlabPool& ChunkColumn::getPool(){
+        static SlabPool* pool = new SlabPool("columns", sizeof(ChunkColumn), alignof(ChunkColumn));
+        return *pool;
+    }
+
+    void* ChunkColumn::operator new(std::size_t size){
+        return (size == sizeof(ChunkColumn)) ? getPool().allocate() : ::operator new(size);
+    }
+
+    void ChunkColumn::operator delete(void* ptr, std::size_t size){
+        if(size == sizeof(ChunkColumn)){
+            getPool().deallocate(ptr);
+        }else{
+            ::operator delete(ptr);
+        }
+    }
+
+    // true si el bloque cuenta para el mapa de alturas indicado
+    static bool countsForHeight(HeightmapType type, BlockID block){
+        if(block == 0){
+            return false;
+        }
+        return type == HEIGHTMAP_SURFACE || !BlockRegistry::getInstance().isTransparent(block);
+    }
+
+    /**
+     * @brief Libera las secciones de la columna y todas las tablas de punteros.
+     *
+     * @note Las secciones pertenecen a la tabla actual; las tablas retiradas (pendientes en
+     *       EpochManager) solo guardan copias de punteros.
+     */
+    ChunkColumn::~ChunkColumn(){
+        SectionTable* table = m_table.load(std::memory_order_acquire);
+        if(table != nullptr){
+            for(int i = 0; i < table->capacity; i++){
+                delete table->slots[i].load(std::memory_order_relaxed);
+            }
+            delete table;
+        }
+    }
+
+    /**
+     * @brief Sustituye la tabla de secciones por una que incluya yIndex.
+     *
+     * Copia los punteros existentes a una tabla nueva (al menos el doble de grande) y la publica
+     * con release. La antigua se retira porque un lector puede estar recorriéndola.
+     *
+     * @param yIndex Índice de sección que debe quedar dentro del rango.
+     * @note Requiere tener m_columnMutex. La tabla antigua se libera por épocas.
+     */
+    void ChunkColumn::growTable(int yIndex){
+        SectionTable* oldTable = m_table.load(std::memory_order_relaxed);
+
+        int minY = INITIAL_TABLE_MIN_Y;
+        int maxY = INITIAL_TABLE_MIN_Y + INITIAL_TABLE_CAPACITY - 1;
+        if(oldTable != nullptr){
+            const int oldMax = oldTable->minY + oldTable->capacity - 1;
+            // Crecemos hacia el lado que se ha desbordado
+            if(yIndex < oldTable->minY){
+                minY = std::min(yIndex, oldTable->minY - oldTable->capacity);
+                maxY = oldMax;
+            }else{
+                minY = oldTable->minY;
+                maxY = std::max(yIndex, oldMax + oldTable->capacity);
+            }
+        }
+        minY = std::min(minY, yIndex);
+        maxY = std::max(maxY, yIndex);
+
+        std::unique_ptr<SectionTable> table = std::make_unique<SectionTable>();
+        table->minY = minY;
+        table->capacity = maxY - minY + 1;
+        table->slots = std::make_unique<std::atomic<ChunkSection*>[]>(table->capacity);
+        for(int i = 0; i < table->capacity; i++){
+            table->slots[i].store(nullptr, std::memory_order_relaxed);
+        }
+        if(oldTable != nullptr){
+            for(int i = 0; i < oldTable->capacity; i++){
+                table->slots[oldTable->minY - minY + i].store(
+                    oldTable->slots[i].load(std::memory_order_relaxed), std::memory_order_relaxed);
+            }
+            EpochManager::getInstance().retire(oldTable);
+        }
+        m_table.store(table.release(), std::memory_order_release);
+    }
 
     ChunkSection* ChunkColumn::getSection(int yIndex){
+        EpochGuard guard;
+        bool created;
+        return getOrCreateSection(yIndex, 0, created);
+    }
+
+    /**
+     * @brief Devuelve la sección yIndex, creándola rellena de 'fill' si no existía.
+     *
+     * @param yIndex Índice vertical de la sección.
+     * @param fill Bloque inicial si hay que crearla (la sección nace uniforme).
+     * @param created Salida: true si esta llamada ha creado la sección.
+     * @note Solo el camino de creación toma m_columnMutex.
+     */
+    ChunkSection* ChunkColumn::getOrCreateSection(int yIndex, BlockID fill, bool& created){
+        created = false;
+        // Camino rápido sin lock: la sección ya existe
+        ChunkSection* existing = findSection(yIndex);
+        if(existing != nullptr){
+            return existing;
+        }
+
         std::lock_guard<std::mutex> lock(m_columnMutex);
-        // Buscamos la sección que nos piden
-        SectionIterator it = m_sections.find(yIndex);
-        if(it != m_sections.end()){
-            return it->second.get();    // Devolvemos la sección
+        // Otro escritor ha podido crearla mientras esperábamos el lock
+        existing = findSection(yIndex);
+        if(existing != nullptr){
+            return existing;
+        }
+
+        SectionTable* table = m_table.load(std::memory_order_relaxed);
+        if(table == nullptr || yIndex < table->minY || yIndex >= table->minY + table->capacity){
+            growTable(yIndex);
+            table = m_table.load(std::memory_order_relaxed);
         }
 
         // En caso de que no exista la sección la creamos
-        SectionPtr newSection = std::make_unique<ChunkSection>(yIndex);
-        ChunkSection* ptr = newSection.get();
-        m_sections[yIndex] = std::move(newSection); // Movemos el puntero a la lista de secciones
-        return ptr;
+        ChunkSection* section = new ChunkSection(yIndex, fill);
+        table->slots[yIndex - table->minY].store(section, std::memory_order_release);
+        created = true;
+
+        if(yIndex < m_minSectionY.load(std::memory_order_relaxed)){
+            m_minSectionY.store(yIndex, std::memory_order_release);
+        }
+        if(yIndex > m_maxSectionY.load(std::memory_order_relaxed)){
+            m_maxSectionY.store(yIndex, std::memory_order_release);
+        }
+        return section;
+    }
+
+    /**
+     * @brief Publica en la cola de cambios una sección recién modificada.
+     *
+     * @param versionBefore Versión leída antes de la edición; si no ha cambiado no hubo escritura.
+     * @note Pasa 0 para secciones recién creadas. Las máscaras ya están marcadas por la sección.
+     */
+    void ChunkColumn::notifyIfChanged(ChunkSection* section, uint64_t versionBefore){
+        if(m_changes == nullptr || section->getVersion() == versionBefore){
+            return;
+        }
+        if(section->claimNotification()){
+            m_changes->push({x, section->getYIndex(), z});
+        }
+    }
+
+    void ChunkColumn::notifySection(ChunkSection* section){
+        if(m_changes != nullptr && section->claimNotification()){
+            m_changes->push({x, section->getYIndex(), z});
+        }
     }
 
     void ChunkColumn::setBlock(int relX,int worldY, int relZ, BlockID block){
+        EpochGuard guard;
         // Bit shift >> 4 es dividir por 16.
         // Identificamos el indice de la sección que 
         // pertenece a la altura worldY 
@@ -34,25 +193,276 @@ namespace AbyssCore {
         // Identificamos la altura dentro de la sección
         int localY = worldY & CHUNK_SECTION_MASK; // Hacemos un modulo 16, usando una mascara
 
-        ChunkSection* section = getSection(sectionIndex);
-        section->setBlock(relX,localY,relZ,block);
-        // CONTINUAR
+        // Poner aire en una sección inexistente no necesita crearla
+        ChunkSection* section = (block == 0) ? findSection(sectionIndex) : getSection(sectionIndex);
+        if(section != nullptr){
+            std::lock_guard<std::mutex> lock(m_heightmapMutex);
+            const uint64_t version = section->getVersion();
+            section->setBlock(relX,localY,relZ,block);
+            updateHeights(relX, worldY, relZ, block);
+            notifyIfChanged(section, version);
+        }
     }
 
-    BlockID ChunkColumn::getBlock(int relX,int worldY,int relZ){
+    /**
+     * @brief Busca hacia abajo el primer bloque que cuenta para el mapa de alturas.
+     *
+     * @param fromY Y mundial desde la que se empieza (inclusiva).
+     * @return int Y mundial encontrada o HEIGHT_NONE.
+     * @note Salta de golpe las secciones inexistentes o vacías.
+     */
+    int ChunkColumn::scanHeightDown(HeightmapType type, int relX, int relZ, int fromY) const {
+        const int minSection = getMinSectionY();
+        const int maxSection = getMaxSectionY();
+        int sy = fromY >> CHUNK_SECTION_SIZE_LOG2;
+        int localY = fromY & CHUNK_SECTION_MASK;
+        if(sy > maxSection){
+            sy = maxSection;
+            localY = CHUNK_SECTION_MASK;
+        }
+        for(; sy >= minSection; sy--, localY = CHUNK_SECTION_MASK){
+            const ChunkSection* section = findSection(sy);
+            if(section == nullptr || section->isEmpty()){
+                continue;
+            }
+            for(int y = localY; y >= 0; y--){
+                if(countsForHeight(type, section->getBlock(relX, y, relZ))){
+                    return (sy * CHUNK_SECTION_SIZE) + y;
+                }
+            }
+        }
+        return HEIGHT_NONE;
+    }
+
+    /**
+     * @brief Actualiza las alturas tras cambiar un único bloque.
+     *
+     * Subir es O(1); bajar solo ocurre si se quita el bloque más alto y busca el siguiente
+     * desde ahí, así que el coste amortizado es O(1).
+     *
+     * @note Requiere m_heightmapMutex.
+     */
+    void ChunkColumn::updateHeights(int relX, int worldY, int relZ, BlockID block){
+        const int column = (relZ << CHUNK_SECTION_SIZE_LOG2) | relX;
+        for(int type = 0; type < HEIGHTMAP_COUNT; type++){
+            std::atomic<int>& height = m_heightmaps[type][column];
+            const int current = height.load(std::memory_order_relaxed);
+            if(countsForHeight(static_cast<HeightmapType>(type), block)){
+                if(worldY > current){
+                    height.store(worldY, std::memory_order_relaxed);
+                }
+            }else if(worldY == current){
+                height.store(scanHeightDown(static_cast<HeightmapType>(type), relX, relZ, worldY - 1), std::memory_order_relaxed);
+            }
+        }
+    }
+
+    /**
+     * @brief Corrige las alturas de un rectángulo (x,z) tras una edición masiva que acaba en worldY1.
+     *
+     * @note Si la altura actual está por encima del lote no ha cambiado; si no, basta buscar
+     *       desde worldY1 hacia abajo. Requiere m_heightmapMutex.
+     */
+    void ChunkColumn::refreshHeights(int relX0, int relZ0, int relX1, int relZ1, int worldY1){
+        for(int type = 0; type < HEIGHTMAP_COUNT; type++){
+            for(int z = relZ0; z <= relZ1; z++){
+                for(int x = relX0; x <= relX1; x++){
+                    std::atomic<int>& height = m_heightmaps[type][(z << CHUNK_SECTION_SIZE_LOG2) | x];
+                    if(height.load(std::memory_order_relaxed) > worldY1){
+                        continue;
+                    }
+                    height.store(scanHeightDown(static_cast<HeightmapType>(type), x, z, worldY1), std::memory_order_relaxed);
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Recalcula ambos mapas de alturas recorriendo las secciones de arriba abajo.
+     *
+     * Usa una copia densa por sección y el kernel vectorial highestNonAir para la superficie;
+     * termina en cuanto todas las columnas tienen altura.
+     */
+    void ChunkColumn::rebuildHeightmaps(){
+        EpochGuard guard;
+        std::lock_guard<std::mutex> lock(m_heightmapMutex);
+        int surface[CHUNK_SECTION_LAYER];
+        int opaque[CHUNK_SECTION_LAYER];
+        for(int i = 0; i < CHUNK_SECTION_LAYER; i++){
+            surface[i] = HEIGHT_NONE;
+            opaque[i] = HEIGHT_NONE;
+        }
+
+        const BlockRegistry& registry = BlockRegistry::getInstance();
+        std::vector<BlockID> dense(CHUNK_SECTION_VOLUME);
+        int8_t sectionTop[CHUNK_SECTION_LAYER];
+        int pendingOpaque = CHUNK_SECTION_LAYER;
+        for(int sy = getMaxSectionY(); sy >= getMinSectionY() && pendingOpaque > 0; sy--){
+            const ChunkSection* section = findSection(sy);
+            if(section == nullptr || section->isEmpty()){
+                continue;
+            }
+            const int baseY = sy * CHUNK_SECTION_SIZE;
+            section->snapshot(dense.data());
+            SectionKernels::highestNonAir(dense.data(), CHUNK_SECTION_SIZE, sectionTop);
+            for(int column = 0; column < CHUNK_SECTION_LAYER; column++){
+                if(sectionTop[column] < 0){
+                    continue;
+                }
+                if(surface[column] == HEIGHT_NONE){
+                    surface[column] = baseY + sectionTop[column];
+                }
+                if(opaque[column] != HEIGHT_NONE){
+                    continue;
+                }
+                // El bloque opaco más alto no puede estar por encima del no aire más alto
+                for(int y = sectionTop[column]; y >= 0; y--){
+                    const BlockID block = dense[(y << CHUNK_SECTION_LAYER_LOG2) | column];
+                    if(block != 0 && !registry.isTransparent(block)){
+                        opaque[column] = baseY + y;
+                        pendingOpaque--;
+                        break;
+                    }
+                }
+            }
+        }
+
+        for(int i = 0; i < CHUNK_SECTION_LAYER; i++){
+            m_heightmaps[HEIGHTMAP_SURFACE][i].store(surface[i], std::memory_order_relaxed);
+            m_heightmaps[HEIGHTMAP_OPAQUE][i].store(opaque[i], std::memory_order_relaxed);
+        }
+    }
+
+    std::size_t ChunkColumn::getMemoryUsage() const {
+        // Con el lock ninguna otra tabla puede sustituir a la actual mientras la medimos
+        std::lock_guard<std::mutex> lock(m_columnMutex);
+        std::size_t bytes = sizeof(*this);
+        const SectionTable* table = m_table.load(std::memory_order_relaxed);
+        if(table != nullptr){
+            bytes += sizeof(SectionTable) + table->capacity * sizeof(std::atomic<ChunkSection*>);
+        }
+        return bytes;
+    }
+
+    std::size_t ChunkColumn::getSectionMemoryUsage() const {
+        EpochGuard guard;
+        std::size_t bytes = 0;
+        for(int sy = getMinSectionY(); sy <= getMaxSectionY(); sy++){
+            const ChunkSection* section = findSection(sy);
+            if(section != nullptr){
+                bytes += section->getMemoryUsage();
+            }
+        }
+        return bytes;
+    }
+
+    BlockID ChunkColumn::getBlock(int relX,int worldY,int relZ) const {
         // Bit shift >> 4 es dividir por 16.
         // Identificamos el indice de la sección que 
         // pertenece a la altura worldY 
         int sectionIndex = worldY >> CHUNK_SECTION_SIZE_LOG2;
         // Identificamos la altura dentro de la sección
         int localY = worldY & CHUNK_SECTION_MASK; // Hacemos un modulo 16, usando una mascara
-        // Si la sección no existe, retornamos aire
-        std::lock_guard<std::mutex> lock(m_columnMutex);
-        SectionIterator it = m_sections.find(sectionIndex);
-        if (it != m_sections.end()) {
-            return it->second->getBlock(relX, localY, relZ);
+        // Si la sección no existe, retornamos aire. Lectura sin lock de columna
+        const ChunkSection* section = findSection(sectionIndex);
+        if (section != nullptr) {
+            return section->getBlock(relX, localY, relZ);
         }
         return 0; // Aire
     }
 
-}
\ No newline at end of file
+    /**
+     * @brief Recorre las secciones que cortan un rango vertical con sus límites locales.
+     *
+     * @param worldY0 Altura mundial inicial (inclusiva).
+     * @param worldY1 Altura mundial final (inclusiva).
+     * @param create Si es true, crea las secciones que no existan.
+     * @param fillIfFull Bloque con el que nace una sección creada que el lote cubre entera.
+     * @param fullXZ true si el lote cubre la capa entera (size x size).
+     * @param op Función (sección, yLocal0, yLocal1). No se llama si la sección ya nació rellena.
+     * @note Encola en m_changes cada sección que el lote haya modificado.
+     * @return int Bloques escritos al crear secciones ya rellenas (sin pasar por op).
+     */
+    template <typename SectionOp>
+    int ChunkColumn::forEachSectionInRange(int worldY0, int worldY1, bool create, BlockID fillIfFull, bool fullXZ, SectionOp op){
+        const int firstSection = worldY0 >> CHUNK_SECTION_SIZE_LOG2;
+        const int lastSection = worldY1 >> CHUNK_SECTION_SIZE_LOG2;
+        int filledOnCreate = 0;
+        for(int sy = firstSection; sy <= lastSection; sy++){
+            const int localY0 = (sy == firstSection) ? (worldY0 & CHUNK_SECTION_MASK) : 0;
+            const int localY1 = (sy == lastSection) ? (worldY1 & CHUNK_SECTION_MASK) : CHUNK_SECTION_MASK;
+            const bool full = fullXZ && localY0 == 0 && localY1 == CHUNK_SECTION_MASK;
+
+            ChunkSection* section = findSection(sy);
+            if(section == nullptr){
+                if(!create){
+                    continue; // Sección inexistente = aire, no hay nada que cambiar
+                }
+                bool created;
+                section = getOrCreateSection(sy, full ? fillIfFull : 0, created);
+                if(created && full){
+                    filledOnCreate += (fillIfFull != 0) ? CHUNK_SECTION_VOLUME : 0;
+                    if(fillIfFull != 0 && m_changes != nullptr && section->claimNotification()){
+                        m_changes->push({x, sy, z}); // Nace marcada entera como modificada
+                    }
+                    continue; // Ha nacido uniforme con el resultado final
+                }
+            }
+            const uint64_t version = section->getVersion();
+            op(section, localY0, localY1);
+            notifyIfChanged(section, version);
+        }
+        return filledOnCreate;
+    }
+
+    void ChunkColumn::fillBox(int relX0, int worldY0, int relZ0, int relX1, int worldY1, int relZ1, BlockID block){
+        EpochGuard guard;
+        std::lock_guard<std::mutex> lock(m_heightmapMutex);
+        const bool fullXZ = relX0 == 0 && relZ0 == 0 && relX1 == CHUNK_SECTION_MASK && relZ1 == CHUNK_SECTION_MASK;
+        forEachSectionInRange(worldY0, worldY1, block != 0, block, fullXZ,
+            [=](ChunkSection* section, int localY0, int localY1){
+                section->fillBox(relX0, localY0, relZ0, relX1, localY1, relZ1, block);
+            });
+        refreshHeights(relX0, relZ0, relX1, relZ1, worldY1);
+    }
+
+    void ChunkColumn::fillLayer(int worldY, BlockID block){
+        fillBox(0, worldY, 0, CHUNK_SECTION_MASK, worldY, CHUNK_SECTION_MASK, block);
+    }
+
+    void ChunkColumn::setRow(int relX0, int worldY, int relZ, const BlockID* blocks, int count){
+        if(count <= 0){
+            return;
+        }
+        EpochGuard guard;
+        ChunkSection* section = getSection(worldY >> CHUNK_SECTION_SIZE_LOG2);
+        std::lock_guard<std::mutex> lock(m_heightmapMutex);
+        const uint64_t version = section->getVersion();
+        section->setRow(relX0, worldY & CHUNK_SECTION_MASK, relZ, blocks, count);
+        refreshHeights(relX0, relZ, relX0 + count - 1, relZ, worldY);
+        notifyIfChanged(section, version);
+    }
+
+    /**
+     * @brief Sustituye 'from' por 'to' en una caja de la columna.
+     *
+     * @return int Bloques sustituidos.
+     * @note Si 'from' es aire hay que crear las secciones que falten, que son aire implícito.
+     */
+    int ChunkColumn::replaceInBox(int relX0, int worldY0, int relZ0, int relX1, int worldY1, int relZ1, BlockID from, BlockID to){
+        EpochGuard guard;
+        if(from == to){
+            return 0;
+        }
+        const bool fullXZ = relX0 == 0 && relZ0 == 0 && relX1 == CHUNK_SECTION_MASK && relZ1 == CHUNK_SECTION_MASK;
+        std::lock_guard<std::mutex> lock(m_heightmapMutex);
+        int replaced = 0;
+        replaced += forEachSectionInRange(worldY0, worldY1, from == 0, to, fullXZ,
+            [&](ChunkSection* section, int localY0, int localY1){
+                replaced += section->replaceInBox(relX0, localY0, relZ0, relX1, localY1, relZ1, from, to);
+            });
+        refreshHeights(relX0, relZ0, relX1, relZ1, worldY1);
+        return replaced;
+    }
+
+}
@@ -1,20 +1,97 @@
 #include "world/ChunkSection.h"
+#include "world/SectionKernels.h"
+#include "world/BlockRegistry.h"
 
 namespace AbyssCore {
 
-    ChunkSection::ChunkSection(int yIndex)
-    : m_yIndex(yIndex), m_blockCount(0) {
-        // Ponemos todos los bloques a aire
-        for (std::atomic<BlockID>& b : m_blocks) {
-            b = 0;
+    // El contenedor arranca uniforme, no hace falta recorrer ni reservar los bloques
+    ChunkSection::ChunkSection(int yIndex, BlockID fill)
+    : m_yIndex(yIndex),
+      m_blockCount(fill != 0 ? CHUNK_SECTION_VOLUME : 0),
+      m_tickableCount(BlockRegistry::getInstance().ticksRandomly(fill) ? CHUNK_SECTION_VOLUME : 0),
+      m_sequence(0),
+      m_storage(new PalettedContainer(CHUNK_SECTION_VOLUME, fill)),
+      m_light{NibbleArray(CHUNK_SECTION_VOLUME, 15), NibbleArray(CHUNK_SECTION_VOLUME, 0)},  // Cielo abierto, sin fuentes
+      m_notifyPending(false) {
+        // Una sección que nace con bloques es contenido nuevo para todos los consumidores
+        for(std::atomic<uint64_t>& cubes : m_dirtyCubes){
+            cubes.store(fill != 0 ? DIRTY_ALL_CUBES : 0, std::memory_order_relaxed);
         }
     }
 
+    ChunkSection::~ChunkSection(){
+        delete m_storage.load(std::memory_order_relaxed);
+    }
+
+    SlabPool& ChunkSection::getPool(){
+        static SlabPool* pool = new SlabPool("sections", sizeof(ChunkSection), alignof(ChunkSection));
+        return *pool;
+    }
+
+    void* ChunkSection::operator new(std::size_t size){
+        return (size == sizeof(ChunkSection)) ? getPool().allocate() : ::operator new(size);
+    }
+
+    void ChunkSection::operator delete(void* ptr, std::size_t size){
+        if(size == sizeof(ChunkSection)){
+            getPool().deallocate(ptr);
+        }else{
+            ::operator delete(ptr);
+        }
+    }
+
+    /**
+     * @brief Abre una escritura: la secuencia pasa a impar.
+     *
+     * @note La barrera release impide que las escrituras de datos se adelanten al cambio de secuencia.
+     */
+    void ChunkSection::beginWrite(){
+        m_sequence.store(m_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_relaxed);
+        std::atomic_thread_fence(std::memory_order_release);
+    }
+
+    void ChunkSection::endWrite(){
+        m_sequence.store(m_sequence.load(std::memory_order_relaxed) + 1, std::memory_order_release);
+    }
+
+    /**
+     * @brief Sustituye el contenedor actual por otro y retira el antiguo.
+     *
+     * @param next Contenedor nuevo, ya completo.
+     * @note Requiere m_writeMutex. El antiguo se retira por épocas: un lector puede estar leyéndolo.
+     */
+    void ChunkSection::publish(std::unique_ptr<PalettedContainer> next){
+        beginWrite();
+        PalettedContainer* old = m_storage.exchange(next.release(), std::memory_order_release);
+        endWrite();
+        EpochManager::getInstance().retire(old);
+    }
+
     void ChunkSection::setBlock(int x, int y, int z, BlockID block){
-        // Índice plano: (y * 16 * 16) + (z * 16) + x
-        int index = (y << CHUNK_SECTION_LAYER_LOG2) | (z << CHUNK_SECTION_SIZE_LOG2) | x;
-        
-        BlockID oldBlock = m_blocks[index].exchange(block); // Cambio seguro ante threads
+        int index = storageIndex(x, y, z);
+
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        PalettedContainer* storage = m_storage.load(std::memory_order_relaxed);
+        BlockID oldBlock = storage->get(index);
+        if(oldBlock == block){
+            return; // Sin cambios no hay nueva versión
+        }
+
+        if(storage->canSetInPlace(index, block)){
+            // Cambio seguro ante threads: los lectores reintentan si coinciden con la escritura
+            beginWrite();
+            storage->set(index, block);
+            endWrite();
+        }else{
+            // Crecimiento de paleta o materialización: trabajamos sobre una copia privada
+            std::unique_ptr<PalettedContainer> next = std::make_unique<PalettedContainer>(*storage);
+            next->set(index, block);
+            storage = next.get();
+            publish(std::move(next));
+        }
+
+        // Reducción (o vuelta a uniforme) con un límite de contenedores pendientes de liberar
+        compactIfNeeded(storage);
         
         // Actualización de bloques vacios
         if(oldBlock == 0 && block != 0){
@@ -22,12 +99,348 @@ namespace AbyssCore {
         }else if(oldBlock != 0 && block == 0){
             m_blockCount--;
         }
-    
+        const BlockRegistry& registry = BlockRegistry::getInstance();
+        const int tickDelta = registry.ticksRandomly(block) - registry.ticksRandomly(oldBlock);
+        if(tickDelta != 0){
+            m_tickableCount += tickDelta;
+        }
+        markDirty(dirtyCubeBit(x, y, z));
+    }
+
+    /**
+     * @brief Marca sub-cubos como modificados para los tipos de consumidor indicados.
+     *
+     * @param cubes Máscara de bits según dirtyCubeBit.
+     * @param kinds Máscara de dirtyKindBit; por defecto todos (cambios de bloques).
+     * @note Se publica después de los datos: quien vea el bit verá también el bloque nuevo.
+     */
+    void ChunkSection::markDirty(uint64_t cubes, uint32_t kinds){
+        for(int kind = 0; kind < DIRTY_KIND_COUNT; kind++){
+            if(kinds & (1u << kind)){
+                m_dirtyCubes[kind].fetch_or(cubes, std::memory_order_release);
+            }
+        }
+    }
+
+    /**
+     * @brief Reduce el contenedor (o lo vuelve uniforme) si le sobra capacidad.
+     *
+     * @param storage Contenedor publicado actualmente.
+     * @note Requiere m_writeMutex.
+     */
+    void ChunkSection::compactIfNeeded(const PalettedContainer* storage){
+        if(storage->wantsCompact()){
+            std::unique_ptr<PalettedContainer> next = std::make_unique<PalettedContainer>(*storage);
+            next->compact();
+            publish(std::move(next));
+        }
+    }
+
+    /**
+     * @brief Aplica una edición a todos los bloques de una caja como un único lote.
+     *
+     * Lotes pequeños: se escriben in situ dentro de una sola ventana del seqlock, pasando a una
+     * copia privada solo si algún bloque obliga a realojar. Lotes grandes: se decodifica a un
+     * array denso, se edita y se recodifica con el ancho mínimo en un único publish.
+     *
+     * @param edit Función (actual, x, y, z) -> nuevo.
+     * @return int Número de bloques que cambiaron.
+     * @note m_blockCount, m_tickableCount y las máscaras de cambios se actualizan una sola vez al final.
+     */
+    template <typename EditFn>
+    int ChunkSection::editBox(int x0, int y0, int z0, int x1, int y1, int z1, EditFn edit){
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        PalettedContainer* storage = m_storage.load(std::memory_order_relaxed);
+        const BlockRegistry& registry = BlockRegistry::getInstance();
+        const int volume = (x1 - x0 + 1) * (y1 - y0 + 1) * (z1 - z0 + 1);
+        int changed = 0;
+        int countDelta = 0;
+        int tickDelta = 0;
+        uint64_t cubes = 0;
+
+        if(volume >= DENSE_EDIT_THRESHOLD){
+            thread_local std::vector<BlockID> dense;
+            dense.resize(CHUNK_SECTION_VOLUME);
+            storage->decode(dense.data());
+            for(int y = y0; y <= y1; y++){
+                for(int z = z0; z <= z1; z++){
+                    for(int x = x0; x <= x1; x++){
+                        BlockID& slot = dense[storageIndex(x, y, z)];
+                        const BlockID block = edit(slot, x, y, z);
+                        if(block != slot){
+                            countDelta += (block != 0) - (slot != 0);
+                            tickDelta += registry.ticksRandomly(block) - registry.ticksRandomly(slot);
+                            slot = block;
+                            cubes |= dirtyCubeBit(x, y, z);
+                            changed++;
+                        }
+                    }
+                }
+            }
+            if(changed != 0){
+                std::unique_ptr<PalettedContainer> next = std::make_unique<PalettedContainer>(CHUNK_SECTION_VOLUME);
+                next->encode(dense.data());
+                publish(std::move(next));
+            }
+        }else{
+            PalettedContainer* target = storage;
+            std::unique_ptr<PalettedContainer> copy;
+            bool writing = false;
+            for(int y = y0; y <= y1; y++){
+                for(int z = z0; z <= z1; z++){
+                    for(int x = x0; x <= x1; x++){
+                        const int index = storageIndex(x, y, z);
+                        const BlockID oldBlock = target->get(index);
+                        const BlockID block = edit(oldBlock, x, y, z);
+                        if(block == oldBlock){
+                            continue;
+                        }
+                        if(!copy && !target->canSetInPlace(index, block)){
+                            // A partir de aquí todo va a una copia privada que se publica al final
+                            if(writing){
+                                endWrite();
+                                writing = false;
+                            }
+                            copy = std::make_unique<PalettedContainer>(*storage);
+                            target = copy.get();
+                        }
+                        if(!copy && !writing){
+                            beginWrite();
+                            writing = true;
+                        }
+                        target->set(index, block);
+                        countDelta += (block != 0) - (oldBlock != 0);
+                        tickDelta += registry.ticksRandomly(block) - registry.ticksRandomly(oldBlock);
+                        cubes |= dirtyCubeBit(x, y, z);
+                        changed++;
+                    }
+                }
+            }
+            if(writing){
+                endWrite();
+            }
+            if(copy){
+                publish(std::move(copy));
+            }
+            compactIfNeeded(target);
+        }
+
+        if(countDelta != 0){
+            m_blockCount += countDelta;
+        }
+        if(tickDelta != 0){
+            m_tickableCount += tickDelta;
+        }
+        if(cubes != 0){
+            markDirty(cubes);
+        }
+        return changed;
+    }
+
+    /**
+     * @brief Rellena una caja local (inclusiva) con un bloque.
+     *
+     * @note Si la caja cubre la sección entera equivale a fill() y deja la sección uniforme.
+     */
+    void ChunkSection::fillBox(int x0, int y0, int z0, int x1, int y1, int z1, BlockID block){
+        if(x0 == 0 && y0 == 0 && z0 == 0 &&
+           x1 == CHUNK_SECTION_MASK && y1 == CHUNK_SECTION_MASK && z1 == CHUNK_SECTION_MASK){
+            fill(block);
+            return;
+        }
+        editBox(x0, y0, z0, x1, y1, z1, [block](BlockID, int, int, int){ return block; });
+    }
+
+    void ChunkSection::fillLayer(int y, BlockID block){
+        fillBox(0, y, 0, CHUNK_SECTION_MASK, y, CHUNK_SECTION_MASK, block);
+    }
+
+    /**
+     * @brief Copia una fila contigua en X desde un buffer.
+     *
+     * @param x0 Primera X local.
+     * @param y Altura local de la fila.
+     * @param z Profundidad local de la fila.
+     * @param blocks Buffer con 'count' bloques.
+     * @param count Longitud de la fila (x0 + count <= 16).
+     */
+    void ChunkSection::setRow(int x0, int y, int z, const BlockID* blocks, int count){
+        if(count <= 0){
+            return;
+        }
+        editBox(x0, y, z, x0 + count - 1, y, z, [blocks, x0](BlockID, int x, int, int){ return blocks[x - x0]; });
+    }
+
+    int ChunkSection::replaceInBox(int x0, int y0, int z0, int x1, int y1, int z1, BlockID from, BlockID to){
+        if(from == to){
+            return 0;
+        }
+        return editBox(x0, y0, z0, x1, y1, z1, [from, to](BlockID current, int, int, int){
+            return (current == from) ? to : current;
+        });
+    }
+
+    /**
+     * @brief Copia la sección completa a un array plano con cargas normales.
+     *
+     * @param out Destino con CHUNK_SECTION_VOLUME entradas, en orden de sectionIndex.
+     * @return uint64_t Versión de la sección que representa la copia.
+     * @note Si un escritor interviene durante la copia se repite entera.
+     *       La salida es lineal también con ABYSS_MORTON_LAYOUT: los kernels y el guardado no dependen del layout.
+     */
+    uint64_t ChunkSection::snapshot(BlockID* out) const {
+        EpochGuard guard;
+        // Con layout Morton se decodifica a un buffer propio y se reordena una vez validada la copia
+        thread_local std::vector<BlockID> stored;
+        BlockID* target = out;
+        if(CHUNK_SECTION_MORTON){
+            stored.resize(CHUNK_SECTION_VOLUME);
+            target = stored.data();
+        }
+        for(;;){
+            const uint64_t seq = m_sequence.load(std::memory_order_acquire);
+            if(seq & 1){
+                continue;
+            }
+            m_storage.load(std::memory_order_acquire)->decode(target);
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if(m_sequence.load(std::memory_order_relaxed) == seq){
+                if(CHUNK_SECTION_MORTON){
+                    for(int y = 0; y < CHUNK_SECTION_SIZE; y++){
+                        for(int z = 0; z < CHUNK_SECTION_SIZE; z++){
+                            BlockID* row = out + sectionIndex(0, y, z);
+                            for(int x = 0; x < CHUNK_SECTION_SIZE; x++){
+                                row[x] = target[storageIndex(x, y, z)];
+                            }
+                        }
+                    }
+                }
+                return seq >> 1;
+            }
+        }
+    }
+
+    /**
+     * @brief Copia una caja de la sección a un buffer con pasos arbitrarios, en una sola pasada consistente.
+     *
+     * @param out Destino; el bloque (x,y,z) va a out[(y-y0)*strideY + (z-z0)*strideZ + (x-x0)].
+     * @return uint64_t Versión de la sección que representa la copia.
+     * @note Pensado para bordes de vecinos: solo decodifica los vóxeles pedidos.
+     */
+    uint64_t ChunkSection::copyRegion(int x0, int y0, int z0, int x1, int y1, int z1,
+                                      BlockID* out, int strideZ, int strideY) const {
+        EpochGuard guard;
+        for(;;){
+            const uint64_t seq = m_sequence.load(std::memory_order_acquire);
+            if(seq & 1){
+                continue;
+            }
+            const PalettedContainer* storage = m_storage.load(std::memory_order_acquire);
+            const bool uniform = storage->isUniform();
+            const BlockID uniformBlock = storage->getUniformBlock();
+            for(int y = y0; y <= y1; y++){
+                for(int z = z0; z <= z1; z++){
+                    BlockID* row = out + (y - y0) * strideY + (z - z0) * strideZ - x0;
+                    for(int x = x0; x <= x1; x++){
+                        row[x] = uniform ? uniformBlock : storage->get(storageIndex(x, y, z));
+                    }
+                }
+            }
+            std::atomic_thread_fence(std::memory_order_acquire);
+            if(m_sequence.load(std::memory_order_relaxed) == seq){
+                return seq >> 1;
+            }
+        }
+    }
+
+    /**
+     * @brief Rellena la sección con un único bloque liberando el almacenamiento empaquetado.
+     *
+     * @param block Bloque de relleno.
+     * @note Útil para generación: secciones de piedra o aire completas no ocupan array.
+     */
+    void ChunkSection::fill(BlockID block){
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        const PalettedContainer* storage = m_storage.load(std::memory_order_relaxed);
+        if(storage->isUniform() && storage->getUniformBlock() == block){
+            return;
+        }
+        publish(std::make_unique<PalettedContainer>(CHUNK_SECTION_VOLUME, block));
+        m_blockCount = (block != 0) ? CHUNK_SECTION_VOLUME : 0;
+        m_tickableCount = BlockRegistry::getInstance().ticksRandomly(block) ? CHUNK_SECTION_VOLUME : 0;
+        markDirty(DIRTY_ALL_CUBES);
+    }
+
+    /**
+     * @brief Recalcula el número de bloques no aire y de bloques con tick aleatorio a partir del contenido real.
+     *
+     * @return int Bloques no aire.
+     * @note Usa el kernel vectorial countNonAir sobre una copia densa; las secciones uniformes no se recorren.
+     */
+    int ChunkSection::recountBlocks(){
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        const PalettedContainer* storage = m_storage.load(std::memory_order_relaxed);
+        const BlockRegistry& registry = BlockRegistry::getInstance();
+        int count;
+        int tickable = 0;
+        if(storage->isUniform()){
+            count = (storage->getUniformBlock() != 0) ? CHUNK_SECTION_VOLUME : 0;
+            tickable = registry.ticksRandomly(storage->getUniformBlock()) ? CHUNK_SECTION_VOLUME : 0;
+        }else{
+            thread_local std::vector<BlockID> dense;
+            dense.resize(CHUNK_SECTION_VOLUME);
+            storage->decode(dense.data());
+            count = SectionKernels::countNonAir(dense.data(), CHUNK_SECTION_VOLUME);
+            for(BlockID block : dense){
+                tickable += registry.ticksRandomly(block);
+            }
+        }
+        m_blockCount = count;
+        m_tickableCount = tickable;
+        return count;
+    }
+
+    /**
+     * @brief Calcula la altura local máxima no aire de cada columna (x, z) de la sección.
+     *
+     * @param heights Destino de CHUNK_SECTION_LAYER entradas indexado por z * 16 + x.
+     * @note Las secciones uniformes se resuelven sin recorrer nada.
+     */
+    void ChunkSection::getHighestNonAir(int8_t* heights) const {
+        if(isUniform()){
+            const int8_t h = (getBlockCount() != 0) ? CHUNK_SECTION_MASK : -1;
+            for(int i = 0; i < CHUNK_SECTION_LAYER; i++){
+                heights[i] = h;
+            }
+            return;
+        }
+        thread_local std::vector<BlockID> dense;
+        dense.resize(CHUNK_SECTION_VOLUME);
+        snapshot(dense.data());
+        SectionKernels::highestNonAir(dense.data(), CHUNK_SECTION_SIZE, heights);
+    }
+
+    // Los campos que consultan estos métodos no cambian dentro de un mismo contenedor
+    bool ChunkSection::isUniform() const {
+        EpochGuard guard;
+        return m_storage.load(std::memory_order_acquire)->isUniform();
+    }
+
+    int ChunkSection::getBitsPerBlock() const {
+        EpochGuard guard;
+        return m_storage.load(std::memory_order_acquire)->getBitsPerBlock();
     }
 
-    BlockID ChunkSection::getBlock(int x, int y, int z) const  {
-            int index = (y << CHUNK_SECTION_LAYER_LOG2) | (z << CHUNK_SECTION_SIZE_LOG2) | x;
-            return m_blocks[index].load();
+    /**
+     * @brief Bytes residentes de la sección (objeto + almacenamiento comprimido + luz no uniforme).
+     *
+     * @return std::size_t Bytes aproximados.
+     * @note Los contenedores pendientes de liberar por épocas no se cuentan.
+     */
+    std::size_t ChunkSection::getMemoryUsage() const {
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        return sizeof(*this) + m_storage.load(std::memory_order_relaxed)->getMemoryUsage() +
+               m_light[LIGHT_SKY].getMemoryUsage() + m_light[LIGHT_BLOCK].getMemoryUsage();
     }
 
-}
\ No newline at end of file
+}
@@ -0,0 +1,142 @@
+#include "world/ColumnMap.h"
+
+namespace AbyssCore {
+
+    ColumnMap::ColumnMap()
+    : m_table(createTable(INITIAL_CAPACITY)), m_count(0), m_usedSlots(0) {}
+
+    ColumnMap::~ColumnMap(){
+        delete m_table.load(std::memory_order_relaxed);
+    }
+
+    ColumnMap::Table* ColumnMap::createTable(std::size_t capacity){
+        Table* table = new Table();
+        table->mask = capacity - 1;
+        table->slots = std::make_unique<Slot[]>(capacity);
+        for(std::size_t i = 0; i < capacity; i++){
+            table->slots[i].used.store(false, std::memory_order_relaxed);
+            table->slots[i].key.store(0, std::memory_order_relaxed);
+            table->slots[i].value.store(nullptr, std::memory_order_relaxed);
+        }
+        return table;
+    }
+
+    /**
+     * @brief Busca una columna sin tomar ningún lock.
+     *
+     * @param key Clave empaquetada (packColumnKey).
+     * @return ChunkColumn* La columna o nullptr si no está cargada.
+     */
+    ChunkColumn* ColumnMap::find(uint64_t key) const {
+        const Table* table = m_table.load(std::memory_order_acquire);
+        std::size_t i = hash(key) & table->mask;
+        for(;;){
+            const Slot& slot = table->slots[i];
+            if(!slot.used.load(std::memory_order_acquire)){
+                return nullptr; // Fin de la cadena de sondeo
+            }
+            if(slot.key.load(std::memory_order_relaxed) == key){
+                return slot.value.load(std::memory_order_acquire);
+            }
+            i = (i + 1) & table->mask;
+        }
+    }
+
+    /**
+     * @brief Inserta una columna si la clave no tiene ya una.
+     *
+     * @param key Clave empaquetada.
+     * @param column Columna a insertar.
+     * @return ChunkColumn* La columna que queda en el mapa (la existente si ya había una).
+     * @note Reutiliza la lápida de la misma clave si la hay. Mantiene la ocupación por debajo del 50%.
+     */
+    ChunkColumn* ColumnMap::insert(uint64_t key, ChunkColumn* column){
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        Table* table = m_table.load(std::memory_order_relaxed);
+        if((m_usedSlots + 1) * 2 > table->mask + 1){
+            // Si casi todo son lápidas basta con limpiar; si no, duplicamos
+            const std::size_t live = m_count.load(std::memory_order_relaxed);
+            rehash((live + 1) * 4 > table->mask + 1 ? (table->mask + 1) * 2 : table->mask + 1);
+            table = m_table.load(std::memory_order_relaxed);
+        }
+
+        std::size_t i = hash(key) & table->mask;
+        for(;;){
+            Slot& slot = table->slots[i];
+            if(!slot.used.load(std::memory_order_relaxed)){
+                slot.key.store(key, std::memory_order_relaxed);
+                slot.value.store(column, std::memory_order_relaxed);
+                slot.used.store(true, std::memory_order_release);
+                m_usedSlots++;
+                break;
+            }
+            if(slot.key.load(std::memory_order_relaxed) == key){
+                ChunkColumn* existing = slot.value.load(std::memory_order_relaxed);
+                if(existing != nullptr){
+                    return existing;
+                }
+                slot.value.store(column, std::memory_order_release);
+                break;
+            }
+            i = (i + 1) & table->mask;
+        }
+        m_count.fetch_add(1, std::memory_order_relaxed);
+        return column;
+    }
+
+    ChunkColumn* ColumnMap::remove(uint64_t key){
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        Table* table = m_table.load(std::memory_order_relaxed);
+        std::size_t i = hash(key) & table->mask;
+        for(;;){
+            Slot& slot = table->slots[i];
+            if(!slot.used.load(std::memory_order_relaxed)){
+                return nullptr;
+            }
+            if(slot.key.load(std::memory_order_relaxed) == key){
+                ChunkColumn* existing = slot.value.exchange(nullptr, std::memory_order_acq_rel);
+                if(existing != nullptr){
+                    m_count.fetch_sub(1, std::memory_order_relaxed);
+                }
+                return existing;
+            }
+            i = (i + 1) & table->mask;
+        }
+    }
+
+    /**
+     * @brief Copia las entradas vivas a una tabla nueva (sin lápidas) y la publica.
+     *
+     * @param capacity Capacidad de la tabla nueva (potencia de 2).
+     * @note Requiere m_writeMutex. La tabla antigua se libera por épocas.
+     */
+    void ColumnMap::rehash(std::size_t capacity){
+        Table* oldTable = m_table.load(std::memory_order_relaxed);
+        Table* table = createTable(capacity);
+        std::size_t used = 0;
+        for(std::size_t i = 0; i <= oldTable->mask; i++){
+            ChunkColumn* column = oldTable->slots[i].value.load(std::memory_order_relaxed);
+            if(column == nullptr){
+                continue;
+            }
+            const uint64_t key = oldTable->slots[i].key.load(std::memory_order_relaxed);
+            std::size_t j = hash(key) & table->mask;
+            while(table->slots[j].used.load(std::memory_order_relaxed)){
+                j = (j + 1) & table->mask;
+            }
+            table->slots[j].key.store(key, std::memory_order_relaxed);
+            table->slots[j].value.store(column, std::memory_order_relaxed);
+            table->slots[j].used.store(true, std::memory_order_relaxed);
+            used++;
+        }
+        m_usedSlots = used;
+        m_table.store(table, std::memory_order_release);
+        EpochManager::getInstance().retire(oldTable);
+    }
+
+    std::size_t ColumnMap::getMemoryUsage() const {
+        std::lock_guard<std::mutex> lock(m_writeMutex);
+        std::size_t bytes = sizeof(Table) + (m_table.load(std::memory_order_relaxed)->mask + 1) * sizeof(Slot);
+        return bytes;
+    }
+}
@@ -0,0 +1,153 @@
+#include "world/Epoch.h"
+
+namespace AbyssCore {
+
+    /**
+     * Registro del hilo actual. Al terminar el hilo se marca libre para otro hilo; lo que quede
+     * en su limbo lo libera cualquier collect() posterior.
+     */
+    struct EpochManager::RecordHandle {
+        ThreadRecord* record = nullptr;
+
+        ~RecordHandle(){
+            if(record != nullptr){
+                record->state.store(0, std::memory_order_release);
+                record->inUse.store(false, std::memory_order_release);
+            }
+        }
+    };
+
+    EpochManager& EpochManager::getInstance(){
+        static EpochManager instance;
+        return instance;
+    }
+
+    EpochManager::EpochManager()
+    : m_epoch(1), m_records(nullptr), m_pending(0) {}
+
+    /**
+     * @brief Libera todo lo pendiente y los registros de hilo.
+     *
+     * @note Se ejecuta al salir del programa, cuando ya no queda ningún lector.
+     */
+    EpochManager::~EpochManager(){
+        ThreadRecord* record = m_records.load(std::memory_order_acquire);
+        while(record != nullptr){
+            for(const Retired& retired : record->limbo){
+                retired.deleter(retired.ptr);
+            }
+            ThreadRecord* next = record->next;
+            delete record;
+            record = next;
+        }
+    }
+
+    /**
+     * @brief Devuelve el registro del hilo actual, reutilizando uno libre o creando otro.
+     */
+    EpochManager::ThreadRecord* EpochManager::getRecord(){
+        thread_local RecordHandle handle;
+        if(handle.record != nullptr){
+            return handle.record;
+        }
+        for(ThreadRecord* record = m_records.load(std::memory_order_acquire); record != nullptr; record = record->next){
+            bool expected = false;
+            if(!record->inUse.load(std::memory_order_relaxed) &&
+               record->inUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel)){
+                handle.record = record;
+                return record;
+            }
+        }
+        ThreadRecord* record = new ThreadRecord();
+        record->inUse.store(true, std::memory_order_relaxed);
+        ThreadRecord* head = m_records.load(std::memory_order_relaxed);
+        do {
+            record->next = head;
+        } while(!m_records.compare_exchange_weak(head, record, std::memory_order_release, std::memory_order_relaxed));
+        handle.record = record;
+        return record;
+    }
+
+    /**
+     * @brief Anuncia la época actual al abrir el guard más externo del hilo.
+     *
+     * @note El exchange seq_cst ordena el anuncio antes de cualquier lectura de punteros del mundo.
+     */
+    void EpochManager::enter(){
+        ThreadRecord* record = getRecord();
+        record->state.exchange((m_epoch.load(std::memory_order_seq_cst) << 1) | 1, std::memory_order_seq_cst);
+    }
+
+    void EpochManager::exit(){
+        getRecord()->state.store(0, std::memory_order_release);
+    }
+
+    /**
+     * @brief Avanza la época global si todos los hilos dentro de un guard han visto la actual.
+     *
+     * @return true si la época ha avanzado (aquí o en otro hilo a la vez).
+     */
+    bool EpochManager::tryAdvance(){
+        uint64_t current = m_epoch.load(std::memory_order_seq_cst);
+        for(ThreadRecord* record = m_records.load(std::memory_order_acquire); record != nullptr; record = record->next){
+            const uint64_t state = record->state.load(std::memory_order_seq_cst);
+            if((state & 1) != 0 && (state >> 1) != current){
+                return false;
+            }
+        }
+        return m_epoch.compare_exchange_strong(current, current + 1, std::memory_order_seq_cst) ||
+               current != m_epoch.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Retira un objeto desenganchado de toda estructura compartida.
+     *
+     * @param ptr Objeto a liberar.
+     * @param deleter Función que lo destruye.
+     * @note Cada COLLECT_INTERVAL retiradas el propio hilo intenta recoger.
+     */
+    void EpochManager::retireRaw(void* ptr, void (*deleter)(void*)){
+        if(ptr == nullptr){
+            return;
+        }
+        ThreadRecord* record = getRecord();
+        {
+            std::lock_guard<std::mutex> lock(record->limboMutex);
+            record->limbo.push_back({ptr, deleter, m_epoch.load(std::memory_order_seq_cst)});
+        }
+        m_pending.fetch_add(1, std::memory_order_relaxed);
+        if(++record->retiredSinceCollect >= COLLECT_INTERVAL){
+            record->retiredSinceCollect = 0;
+            collect();
+        }
+    }
+
+    /**
+     * @brief Libera los objetos retirados hace al menos dos épocas, de todos los hilos.
+     *
+     * @return std::size_t Objetos liberados.
+     * @note Los destructores se ejecutan fuera de los locks de limbo.
+     */
+    std::size_t EpochManager::collect(){
+        tryAdvance();
+        const uint64_t epoch = m_epoch.load(std::memory_order_seq_cst);
+        std::vector<Retired> ready;
+        for(ThreadRecord* record = m_records.load(std::memory_order_acquire); record != nullptr; record = record->next){
+            std::lock_guard<std::mutex> lock(record->limboMutex);
+            std::size_t kept = 0;
+            for(const Retired& retired : record->limbo){
+                if(retired.epoch + 2 <= epoch){
+                    ready.push_back(retired);
+                }else{
+                    record->limbo[kept++] = retired;
+                }
+            }
+            record->limbo.resize(kept);
+        }
+        for(const Retired& retired : ready){
+            retired.deleter(retired.ptr);
+        }
+        m_pending.fetch_sub(ready.size(), std::memory_order_relaxed);
+        return ready.size();
+    }
+}
@@ -0,0 +1,315 @@
+#include "world/FluidSimulation.h"
+#include <algorithm>
+#include <climits>
+
+namespace AbyssCore {
+
+    // Lectura de una celda por la que el fluido no pasa (columna no cargada o bajo la columna)
+    static constexpr BlockID BLOCKED = ~BlockID(0);
+
+    // Vecinos horizontales: -X, +X, -Z, +Z
+    static constexpr int SIDE_OFFSETS[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+
+    // Celda empaquetada para ordenar el frente por columna, capa, Z y X:
+    // columna X (20 bits) | columna Z (20) | Y + 2048 (12) | Z local | X local
+    static constexpr int CELL_Y_SHIFT = 2 * CHUNK_SECTION_SIZE_LOG2;
+    static constexpr int CELL_CHUNK_Z_SHIFT = CELL_Y_SHIFT + 12;
+    static constexpr int CELL_CHUNK_X_SHIFT = CELL_CHUNK_Z_SHIFT + 20;
+    static constexpr int CELL_Y_BIAS = 2048;
+    static constexpr int CELL_CHUNK_BIAS = 1 << 19;
+
+    static uint64_t packCell(int x, int y, int z){
+        const uint64_t chunkX = static_cast<uint64_t>(World::toChunkCoord(x) + CELL_CHUNK_BIAS) & 0xFFFFF;
+        const uint64_t chunkZ = static_cast<uint64_t>(World::toChunkCoord(z) + CELL_CHUNK_BIAS) & 0xFFFFF;
+        return (chunkX << CELL_CHUNK_X_SHIFT) | (chunkZ << CELL_CHUNK_Z_SHIFT) |
+               (static_cast<uint64_t>(y + CELL_Y_BIAS) << CELL_Y_SHIFT) |
+               static_cast<uint64_t>((World::toLocalCoord(z) << CHUNK_SECTION_SIZE_LOG2) | World::toLocalCoord(x));
+    }
+
+    // Bits de columna de una celda empaquetada: iguales para todas las celdas de la misma columna
+    static uint64_t cellColumnBits(uint64_t cell){
+        return cell >> CELL_CHUNK_Z_SHIFT;
+    }
+
+    static void unpackCell(uint64_t cell, int& x, int& y, int& z){
+        const int chunkX = static_cast<int>((cell >> CELL_CHUNK_X_SHIFT) & 0xFFFFF) - CELL_CHUNK_BIAS;
+        const int chunkZ = static_cast<int>((cell >> CELL_CHUNK_Z_SHIFT) & 0xFFFFF) - CELL_CHUNK_BIAS;
+        y = static_cast<int>((cell >> CELL_Y_SHIFT) & 0xFFF) - CELL_Y_BIAS;
+        z = chunkZ * CHUNK_SECTION_SIZE + static_cast<int>((cell >> CHUNK_SECTION_SIZE_LOG2) & CHUNK_SECTION_MASK);
+        x = chunkX * CHUNK_SECTION_SIZE + static_cast<int>(cell & CHUNK_SECTION_MASK);
+    }
+
+    /**
+     * @brief Lecturas de bloques alrededor de una columna: ella y sus 8 vecinas resueltas una vez.
+     *
+     * El frente va ordenado por columna, así que cada trabajo cambia de columna pocas veces.
+     * Requiere un EpochGuard activo.
+     */
+    class FluidNeighborhood {
+        public:
+            explicit FluidNeighborhood(const World& world) : m_world(world), m_chunkX(INT_MIN), m_chunkZ(INT_MIN) {}
+
+            void moveTo(int chunkX, int chunkZ){
+                if(chunkX == m_chunkX && chunkZ == m_chunkZ){
+                    return;
+                }
+                m_chunkX = chunkX;
+                m_chunkZ = chunkZ;
+                for(int dz = 0; dz < 3; dz++){
+                    for(int dx = 0; dx < 3; dx++){
+                        const ChunkColumn* column = m_world.getColumn(chunkX + dx - 1, chunkZ + dz - 1);
+                        m_columns[dz][dx] = column;
+                        m_bottomY[dz][dx] = (column != nullptr) ? column->getMinSectionY() * CHUNK_SECTION_SIZE : INT_MAX;
+                    }
+                }
+            }
+
+            // (x, z) a una columna como mucho de la actual
+            BlockID read(int x, int y, int z) const {
+                const int dx = World::toChunkCoord(x) - m_chunkX + 1, dz = World::toChunkCoord(z) - m_chunkZ + 1;
+                const ChunkColumn* column = m_columns[dz][dx];
+                if(column == nullptr || y < m_bottomY[dz][dx]){
+                    return BLOCKED;
+                }
+                return column->getBlock(World::toLocalCoord(x), y, World::toLocalCoord(z));
+            }
+
+        private:
+            const World& m_world;
+            int m_chunkX, m_chunkZ;
+            const ChunkColumn* m_columns[3][3];
+            int m_bottomY[3][3];
+    };
+
+    FluidSimulation::FluidSimulation(World& world, int workerThreads)
+    : m_world(world),
+      m_registry(BlockRegistry::getInstance()),
+      m_tick(0),
+      m_cellsProcessed(0),
+      m_jobFn(nullptr),
+      m_jobCount(0),
+      m_nextJob(0),
+      m_busyWorkers(0),
+      m_generation(0),
+      m_stopping(false) {
+        addFluid({BLOCK_WATER, 1, 7, 5, true});
+        addFluid({BLOCK_LAVA, 2, 6, 30, false});
+        for(int i = 0; i < workerThreads; i++){
+            m_threads.emplace_back(&FluidSimulation::workerLoop, this);
+        }
+    }
+
+    FluidSimulation::~FluidSimulation(){
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wake.notify_all();
+        for(std::thread& thread : m_threads){
+            thread.join();
+        }
+    }
+
+    void FluidSimulation::addFluid(const FluidType& fluid){
+        m_fluids.push_back({fluid, 0, 0, 0, {}});
+    }
+
+    // La celda y sus 6 vecinas entran en el frente de todos los fluidos
+    void FluidSimulation::activate(int x, int y, int z){
+        static constexpr int OFFSETS[7][3] = {{0, 0, 0}, {-1, 0, 0}, {1, 0, 0}, {0, -1, 0}, {0, 1, 0}, {0, 0, -1}, {0, 0, 1}};
+        for(const int (&offset)[3] : OFFSETS){
+            const int ny = y + offset[1];
+            if(ny < -CELL_Y_BIAS || ny >= CELL_Y_BIAS){
+                continue;
+            }
+            const uint64_t cell = packCell(x + offset[0], ny, z + offset[2]);
+            for(Fluid& fluid : m_fluids){
+                fluid.frontier.push_back(cell);
+            }
+        }
+    }
+
+    void FluidSimulation::onBlockChanged(int x, int y, int z){
+        activate(x, y, z);
+    }
+
+    std::size_t FluidSimulation::getActiveCount() const {
+        std::size_t count = 0;
+        for(const Fluid& fluid : m_fluids){
+            count += fluid.frontier.size();
+        }
+        return count;
+    }
+
+    void FluidSimulation::tick(){
+        m_tick++;
+        m_changes.clear();
+        for(int i = 0; i < getFluidCount(); i++){
+            if(m_tick % m_fluids[i].type.tickDelay == 0 && !m_fluids[i].frontier.empty()){
+                step(i);
+            }
+        }
+    }
+
+    /**
+     * @brief Un paso del autómata para un fluido: evaluar el frente, aplicar y formar el siguiente.
+     *
+     * @return int Celdas distintas evaluadas.
+     */
+    int FluidSimulation::step(int fluidIndex){
+        Fluid& fluid = m_fluids[fluidIndex];
+        if(fluid.type.block >= m_registry.size()){
+            fluid.frontier.clear();     // Registro sin iniciar: no hay fluido que mover
+            return 0;
+        }
+        const BlockType& type = m_registry.getType(fluid.type.block);
+        fluid.base = type.baseState;
+        fluid.falling = type.baseState + BlockProperties::FALLING.with(0, 1);
+        fluid.stateCount = type.stateCount;
+
+        std::vector<uint64_t> cells;
+        cells.swap(fluid.frontier);
+        std::sort(cells.begin(), cells.end());
+        cells.erase(std::unique(cells.begin(), cells.end()), cells.end());
+
+        // Tramos de al menos JOB_CELLS celdas que acaban en un cambio de columna
+        m_jobs.clear();
+        std::size_t begin = 0;
+        for(std::size_t i = 1; i <= cells.size(); i++){
+            if(i == cells.size() || (i - begin >= JOB_CELLS && cellColumnBits(cells[i]) != cellColumnBits(cells[i - 1]))){
+                m_jobs.push_back({begin, i});
+                begin = i;
+            }
+        }
+        const int jobs = static_cast<int>(m_jobs.size());
+        if(static_cast<int>(m_results.size()) < jobs){
+            m_results.resize(jobs);
+        }
+
+        // Fase 1: nadie escribe, todos leen el estado anterior
+        runJobs(jobs, [this, &fluid, &cells](int job){
+            m_results[job].clear();
+            evaluateJob(fluid, cells, m_jobs[job], m_results[job]);
+        });
+        // Fase 2: cada trabajo escribe solo en sus columnas
+        runJobs(jobs, [this](int job){
+            applyJob(m_results[job]);
+        });
+
+        for(int job = 0; job < jobs; job++){
+            for(const FluidChange& change : m_results[job]){
+                activate(change.x, change.y, change.z);
+                m_changes.push_back(change);
+            }
+        }
+        m_cellsProcessed += cells.size();
+        return static_cast<int>(cells.size());
+    }
+
+    void FluidSimulation::evaluateJob(const Fluid& fluid, const std::vector<uint64_t>& cells, const Job& job,
+                                      std::vector<FluidChange>& out) const {
+        EpochGuard guard;
+        FluidNeighborhood blocks(m_world);
+        const auto isFluid = [&fluid](BlockID block){ return block - fluid.base < fluid.stateCount; };
+        // Cae por su hueco: debajo hay aire o el mismo fluido sin ser fuente
+        const auto fallsThrough = [&fluid, &isFluid](BlockID below){ return below == 0 || (isFluid(below) && below != fluid.base); };
+
+        for(std::size_t i = job.begin; i < job.end; i++){
+            int x, y, z;
+            unpackCell(cells[i], x, y, z);
+            blocks.moveTo(World::toChunkCoord(x), World::toChunkCoord(z));
+            const BlockID current = blocks.read(x, y, z);
+            // Fuentes, sólidos y el otro fluido no cambian
+            if(current == fluid.base || (current != 0 && !isFluid(current))){
+                continue;
+            }
+
+            BlockID next = 0;
+            if(isFluid(blocks.read(x, y + 1, z))){
+                next = fluid.falling;
+            }else{
+                int best = INT_MAX;
+                int sources = 0;
+                for(const int (&side)[2] : SIDE_OFFSETS){
+                    const int nx = x + side[0], nz = z + side[1];
+                    const BlockID neighbor = blocks.read(nx, y, nz);
+                    if(!isFluid(neighbor)){
+                        continue;
+                    }
+                    sources += (neighbor == fluid.base);
+                    if(fallsThrough(blocks.read(nx, y - 1, nz))){
+                        continue;
+                    }
+                    // Cayendo se extiende como una fuente
+                    const int level = (neighbor == fluid.falling) ? 0 : static_cast<int>(BlockProperties::LEVEL.get(neighbor - fluid.base));
+                    best = std::min(best, level + fluid.type.levelDrop);
+                }
+                if(fluid.type.infiniteSources && sources >= 2){
+                    const BlockID below = blocks.read(x, y - 1, z);
+                    if(below == fluid.base || (below != 0 && !isFluid(below))){
+                        best = 0;
+                    }
+                }
+                if(best <= fluid.type.maxLevel){
+                    next = fluid.base + BlockProperties::LEVEL.with(0, static_cast<uint32_t>(best));
+                }
+            }
+            if(next != current){
+                out.push_back({x, y, z, current, next});
+            }
+        }
+    }
+
+    void FluidSimulation::applyJob(const std::vector<FluidChange>& changes){
+        EpochGuard guard;
+        ChunkColumn* column = nullptr;
+        for(const FluidChange& change : changes){
+            const int chunkX = World::toChunkCoord(change.x), chunkZ = World::toChunkCoord(change.z);
+            if(column == nullptr || column->x != chunkX || column->z != chunkZ){
+                column = m_world.getColumn(chunkX, chunkZ);
+            }
+            column->setBlock(World::toLocalCoord(change.x), change.y, World::toLocalCoord(change.z), change.newBlock);
+        }
+    }
+
+    void FluidSimulation::runJobs(int jobs, const std::function<void(int)>& fn){
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_jobFn = &fn;
+            m_jobCount = jobs;
+            m_nextJob.store(0, std::memory_order_relaxed);
+            m_busyWorkers = static_cast<int>(m_threads.size());
+            m_generation++;
+        }
+        m_wake.notify_all();
+        runPendingJobs();
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_done.wait(lock, [this]{ return m_busyWorkers == 0; });
+        m_jobFn = nullptr;
+    }
+
+    void FluidSimulation::runPendingJobs(){
+        for(int job = m_nextJob.fetch_add(1); job < m_jobCount; job = m_nextJob.fetch_add(1)){
+            (*m_jobFn)(job);
+        }
+    }
+
+    void FluidSimulation::workerLoop(){
+        uint64_t seen = 0;
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for(;;){
+            m_wake.wait(lock, [this, seen]{ return m_stopping || m_generation != seen; });
+            if(m_stopping){
+                return;
+            }
+            seen = m_generation;
+            lock.unlock();
+            runPendingJobs();
+            lock.lock();
+            if(--m_busyWorkers == 0){
+                m_done.notify_all();
+            }
+        }
+    }
+
+}
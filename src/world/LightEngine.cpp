@@ -0,0 +1,605 @@
+#include "world/LightEngine.h"
+#include <algorithm>
+#include <climits>
+
+namespace AbyssCore {
+
+    // La luz nueva cambia lo que se dibuja, se guarda y se envía, pero no pide recalcular luz
+    static constexpr uint32_t LIGHT_DIRTY_KINDS =
+        dirtyKindBit(DIRTY_MESH) | dirtyKindBit(DIRTY_SAVE) | dirtyKindBit(DIRTY_NETWORK);
+
+    // Vecinos en orden BlockFace
+    static constexpr int FACE_OFFSETS[FACE_COUNT][3] = {
+        {-1, 0, 0}, {1, 0, 0}, {0, -1, 0}, {0, 1, 0}, {0, 0, -1}, {0, 0, 1}
+    };
+    // Vecinos horizontales: -X, +X, -Z, +Z
+    static constexpr int SIDE_OFFSETS[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+
+    // Lado de la región vecina hacia el que sale un paso horizontal (orden de SIDE_OFFSETS)
+    static int spillSide(int face){
+        return (face == FACE_NEG_X) ? 0 : (face == FACE_POS_X) ? 1 : (face == FACE_NEG_Z) ? 2 : 3;
+    }
+
+    // Luz de una celda sin sección (aire a cielo abierto)
+    static uint8_t implicitLight(LightType type){
+        return (type == LIGHT_SKY) ? LIGHT_MAX : 0;
+    }
+
+    /**
+     * @brief Nivel que recibe un vecino desde una celda con nivel 'level'.
+     *
+     * @param face Dirección del paso; la luz del cielo a nivel máximo baja sin perder nada por bloques de opacidad 0.
+     * @param opacity Opacidad del bloque del vecino.
+     * @return int Nivel resultante, 0 o negativo si no llega luz.
+     */
+    static int spreadLevel(LightType type, int face, int level, int opacity){
+        if(type == LIGHT_SKY && face == FACE_NEG_Y && level == LIGHT_MAX && opacity == 0){
+            return LIGHT_MAX;
+        }
+        return level - std::max(1, opacity);
+    }
+
+    LightEngine::LightEngine(World& world)
+    : m_world(world),
+      m_registry(BlockRegistry::getInstance()),
+      m_regionX0(INT_MIN),
+      m_regionZ0(INT_MIN),
+      m_regionX1(INT_MAX),
+      m_regionZ1(INT_MAX) {
+        for(SectionSlot& slot : m_slots){
+            slot = SectionSlot{0, 0, 0, SLOT_EMPTY, nullptr, nullptr, 0};
+        }
+    }
+
+    void LightEngine::setRegion(int chunkX0, int chunkZ0, int chunkX1, int chunkZ1){
+        m_regionX0 = chunkX0;
+        m_regionZ0 = chunkZ0;
+        m_regionX1 = chunkX1;
+        m_regionZ1 = chunkZ1;
+    }
+
+    /**
+     * @brief Resuelve la sección de una posición mundial a través de la caché.
+     *
+     * @return SectionSlot& Entrada válida hasta la siguiente llamada que caiga en el mismo hueco.
+     * @note La caché es de mapeo directo; la entrada desalojada marca antes sus sub-cubos escritos.
+     */
+    LightEngine::SectionSlot& LightEngine::slotAt(int x, int y, int z){
+        const int chunkX = x >> CHUNK_SECTION_SIZE_LOG2;
+        const int sectionY = y >> CHUNK_SECTION_SIZE_LOG2;
+        const int chunkZ = z >> CHUNK_SECTION_SIZE_LOG2;
+        const unsigned hash = (static_cast<unsigned>(chunkX) * 73856093u) ^
+                              (static_cast<unsigned>(sectionY) * 19349663u) ^
+                              (static_cast<unsigned>(chunkZ) * 83492791u);
+        SectionSlot& slot = m_slots[hash & (SLOT_CACHE_SIZE - 1)];
+        if(slot.state != SLOT_EMPTY && slot.chunkX == chunkX && slot.sectionY == sectionY && slot.chunkZ == chunkZ){
+            return slot;
+        }
+        if(slot.dirty != 0){
+            slot.section->markDirty(slot.dirty, LIGHT_DIRTY_KINDS);
+            slot.column->notifySection(slot.section);
+        }
+
+        slot = SectionSlot{chunkX, sectionY, chunkZ, SLOT_BLOCKED, nullptr, nullptr, 0};
+        ChunkColumn* column = m_world.getColumn(chunkX, chunkZ);
+        if(column == nullptr || !column->isLightReady()){
+            return slot; // Sin luz calculada todavía sus secciones tendrían el cielo por defecto
+        }
+        slot.column = column;
+        slot.section = column->findSection(sectionY);
+        if(slot.section != nullptr){
+            slot.state = SLOT_SECTION;
+        }else if(column->getMinSectionY() > column->getMaxSectionY() || sectionY >= column->getMinSectionY()){
+            slot.state = SLOT_OPEN;
+        }
+        return slot;
+    }
+
+    uint8_t LightEngine::readLight(const SectionSlot& slot, LightType type, int x, int y, int z){
+        switch(slot.state){
+            case SLOT_SECTION:
+                return slot.section->getLight(type, x & CHUNK_SECTION_MASK, y & CHUNK_SECTION_MASK, z & CHUNK_SECTION_MASK);
+            case SLOT_OPEN:
+                return implicitLight(type);
+            default:
+                return 0;
+        }
+    }
+
+    BlockID LightEngine::readBlock(const SectionSlot& slot, int x, int y, int z){
+        if(slot.state != SLOT_SECTION){
+            return 0;
+        }
+        return slot.section->getBlock(x & CHUNK_SECTION_MASK, y & CHUNK_SECTION_MASK, z & CHUNK_SECTION_MASK);
+    }
+
+    /**
+     * @brief Escribe un nivel y apunta el sub-cubo para marcarlo al vaciar la caché.
+     *
+     * @note En una celda sin sección solo se crea la sección si el nivel difiere del implícito.
+     */
+    void LightEngine::writeLight(SectionSlot& slot, LightType type, int x, int y, int z, uint8_t level){
+        if(slot.state == SLOT_BLOCKED){
+            return;
+        }
+        if(slot.state == SLOT_OPEN){
+            if(level == implicitLight(type)){
+                return;
+            }
+            slot.section = slot.column->getSection(slot.sectionY);
+            slot.state = SLOT_SECTION;
+        }
+        const int lx = x & CHUNK_SECTION_MASK, ly = y & CHUNK_SECTION_MASK, lz = z & CHUNK_SECTION_MASK;
+        slot.section->setLight(type, lx, ly, lz, level);
+        slot.dirty |= dirtyCubeBit(lx, ly, lz);
+    }
+
+    // Marca las secciones escritas y vacía la caché: sus punteros solo valen dentro del EpochGuard
+    void LightEngine::flush(){
+        for(SectionSlot& slot : m_slots){
+            if(slot.dirty != 0){
+                slot.section->markDirty(slot.dirty, LIGHT_DIRTY_KINDS);
+                slot.column->notifySection(slot.section);
+            }
+            slot.state = SLOT_EMPTY;
+            slot.dirty = 0;
+        }
+    }
+
+    /**
+     * @brief Borrado BFS: apaga la luz que dependía de las celdas encoladas.
+     *
+     * Un vecino depende de la celda si tiene menos nivel (o, en el cielo, si es la columna de 15
+     * que baja desde ella). Los vecinos que no dependen quedan encolados como fuentes para que
+     * propagateAdds rellene la zona apagada; los emisores apagados se vuelven a encender.
+     */
+    void LightEngine::propagateRemovals(LightType type){
+        std::vector<LightNode>& queue = m_removeQueue[type];
+        std::vector<LightNode>& adds = m_addQueue[type];
+        for(std::size_t i = 0; i < queue.size(); i++){
+            const LightNode node = queue[i];
+            const bool owned = owns(node.x, node.z);
+            for(int face = 0; face < FACE_COUNT; face++){
+                const int nx = node.x + FACE_OFFSETS[face][0];
+                const int ny = node.y + FACE_OFFSETS[face][1];
+                const int nz = node.z + FACE_OFFSETS[face][2];
+                if(!owns(nx, nz)){
+                    if(owned){
+                        m_spills[spillSide(face)][type].push_back(node);
+                    }
+                    continue;
+                }
+                SectionSlot& slot = slotAt(nx, ny, nz);
+                if(slot.state == SLOT_BLOCKED){
+                    continue;
+                }
+                const uint8_t level = readLight(slot, type, nx, ny, nz);
+                if(level == 0){
+                    continue;
+                }
+                const bool dependent = level < node.level ||
+                    (type == LIGHT_SKY && face == FACE_NEG_Y && node.level == LIGHT_MAX && level == LIGHT_MAX);
+                if(!dependent){
+                    adds.push_back({nx, ny, nz, level});
+                    continue;
+                }
+                writeLight(slot, type, nx, ny, nz, 0);
+                queue.push_back({nx, ny, nz, level});
+                if(type == LIGHT_BLOCK){
+                    const uint8_t emission = m_registry.getLightEmission(readBlock(slot, nx, ny, nz));
+                    if(emission != 0){
+                        writeLight(slot, type, nx, ny, nz, emission);
+                        adds.push_back({nx, ny, nz, emission});
+                    }
+                }
+            }
+        }
+        queue.clear();
+    }
+
+    /**
+     * @brief Propagación BFS desde las celdas encoladas con su nivel actual.
+     *
+     * @note Solo se escribe un vecino si el nivel nuevo mejora el que ya tiene: cada celda se
+     *       visita como mucho una vez por nivel.
+     */
+    void LightEngine::propagateAdds(LightType type){
+        std::vector<LightNode>& queue = m_addQueue[type];
+        for(std::size_t i = 0; i < queue.size(); i++){
+            const LightNode node = queue[i];
+            // Un nodo de otra región llega con el nivel que tenía al reenviarse: no se lee su celda
+            const bool owned = owns(node.x, node.z);
+            const uint8_t level = owned ? readLight(slotAt(node.x, node.y, node.z), type, node.x, node.y, node.z) : node.level;
+            if(level <= 1){
+                continue;
+            }
+            for(int face = 0; face < FACE_COUNT; face++){
+                const int nx = node.x + FACE_OFFSETS[face][0];
+                const int ny = node.y + FACE_OFFSETS[face][1];
+                const int nz = node.z + FACE_OFFSETS[face][2];
+                if(!owns(nx, nz)){
+                    if(owned){
+                        m_spills[spillSide(face)][type].push_back({node.x, node.y, node.z, level});
+                    }
+                    continue;
+                }
+                SectionSlot& slot = slotAt(nx, ny, nz);
+                if(slot.state == SLOT_BLOCKED){
+                    continue;
+                }
+                // Antes que el bloque: casi siempre el vecino ya tiene tanta luz como podría recibir
+                const uint8_t current = readLight(slot, type, nx, ny, nz);
+                if(current >= spreadLevel(type, face, level, 0)){
+                    continue;
+                }
+                const int opacity = m_registry.getLightOpacity(readBlock(slot, nx, ny, nz));
+                const int spread = spreadLevel(type, face, level, opacity);
+                if(spread <= current){
+                    continue;
+                }
+                writeLight(slot, type, nx, ny, nz, static_cast<uint8_t>(spread));
+                queue.push_back({nx, ny, nz, static_cast<uint8_t>(spread)});
+            }
+        }
+        queue.clear();
+    }
+
+    void LightEngine::update(){
+        EpochGuard guard;
+        for(int type = 0; type < LIGHT_TYPE_COUNT; type++){
+            propagateRemovals(static_cast<LightType>(type));
+            propagateAdds(static_cast<LightType>(type));
+        }
+        flush();
+    }
+
+    bool LightEngine::hasPendingUpdates() const {
+        for(int type = 0; type < LIGHT_TYPE_COUNT; type++){
+            if(!m_addQueue[type].empty() || !m_removeQueue[type].empty()){
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /**
+     * @brief Encola el efecto de un cambio de bloque ya escrito en el mundo.
+     *
+     * @param oldBlock Bloque que había antes.
+     * @param newBlock Bloque que hay ahora.
+     * @note Si opacidad y emisión no cambian no hay nada que hacer. El cielo solo se toca si
+     *       cambia la opacidad: encender una lámpara a cielo abierto no apaga la columna de debajo.
+     */
+    void LightEngine::onBlockChanged(int x, int y, int z, BlockID oldBlock, BlockID newBlock){
+        const uint8_t opacityBefore = m_registry.getLightOpacity(oldBlock);
+        const uint8_t opacityAfter = m_registry.getLightOpacity(newBlock);
+        const uint8_t emission = m_registry.getLightEmission(newBlock);
+        if(opacityBefore == opacityAfter && m_registry.getLightEmission(oldBlock) == emission){
+            return;
+        }
+
+        EpochGuard guard;
+        if(slotAt(x, y, z).state == SLOT_BLOCKED){
+            flush();
+            return;
+        }
+        for(int type = 0; type < LIGHT_TYPE_COUNT; type++){
+            const LightType lightType = static_cast<LightType>(type);
+            if(lightType == LIGHT_SKY && opacityBefore == opacityAfter){
+                continue;
+            }
+            SectionSlot& slot = slotAt(x, y, z);
+            const uint8_t level = readLight(slot, lightType, x, y, z);
+            if(level != 0){
+                writeLight(slot, lightType, x, y, z, 0);
+                m_removeQueue[type].push_back({x, y, z, level});
+            }
+            if(lightType == LIGHT_BLOCK && emission != 0){
+                writeLight(slot, lightType, x, y, z, emission);
+                m_addQueue[type].push_back({x, y, z, emission});
+            }
+            // Los vecinos vuelven a entrar en la celda (imprescindible si antes estaba a 0)
+            for(int face = 0; face < FACE_COUNT; face++){
+                m_addQueue[type].push_back({x + FACE_OFFSETS[face][0], y + FACE_OFFSETS[face][1], z + FACE_OFFSETS[face][2], 0});
+            }
+        }
+        flush();
+    }
+
+    /**
+     * @brief Escribe un bloque en el mundo y encola su efecto en la luz.
+     *
+     * @note Si la escritura crea secciones por debajo de la columna, nacen a oscuras (no a cielo
+     *       abierto como las de arriba) y se rellenan desde la capa inferior de la antigua sección más baja.
+     */
+    void LightEngine::setBlock(int x, int y, int z, BlockID block){
+        EpochGuard guard;
+        const BlockID oldBlock = m_world.getBlock(x, y, z);
+        if(oldBlock == block){
+            return;
+        }
+        const ChunkColumn* before = m_world.getColumn(World::toChunkCoord(x), World::toChunkCoord(z));
+        const int minBefore = (before != nullptr) ? before->getMinSectionY() : INT_MAX;
+        const bool hadSections = before != nullptr && minBefore <= before->getMaxSectionY();
+
+        m_world.setBlock(x, y, z, block);
+
+        ChunkColumn* column = m_world.getColumn(World::toChunkCoord(x), World::toChunkCoord(z));
+        if(hadSections && column != nullptr && column->getMinSectionY() < minBefore){
+            for(int sy = column->getMinSectionY(); sy < minBefore; sy++){
+                column->getSection(sy)->getLightArray(LIGHT_SKY).fill(0);
+            }
+            const int baseX = column->x * CHUNK_SECTION_SIZE, baseZ = column->z * CHUNK_SECTION_SIZE;
+            for(int lz = 0; lz < CHUNK_SECTION_SIZE; lz++){
+                for(int lx = 0; lx < CHUNK_SECTION_SIZE; lx++){
+                    m_addQueue[LIGHT_SKY].push_back({baseX + lx, minBefore * CHUNK_SECTION_SIZE, baseZ + lz, 0});
+                }
+            }
+        }
+        onBlockChanged(x, y, z, oldBlock, block);
+    }
+
+    /**
+     * @brief Ilumina una columna recién generada o cargada.
+     *
+     * @param chunkX Coordenada X de la columna.
+     * @param chunkZ Coordenada Z de la columna.
+     * @note Crea las secciones que falten entre la más baja y la más alta, siembra cielo y
+     *       emisores y propaga en el acto, también hacia las columnas vecinas cargadas.
+     *       Pensada para columnas sin luz previa: volver a llamarla no apaga luz propagada antes.
+     */
+    void LightEngine::lightColumn(int chunkX, int chunkZ){
+        EpochGuard guard;
+        seedColumn(chunkX, chunkZ);
+        enqueueColumnBorders(chunkX, chunkZ);
+        update();
+    }
+
+    /**
+     * @brief Siembra cielo y emisores de una columna sin propagar y la marca como iluminada.
+     *
+     * @note Requiere un EpochGuard activo. No lee ninguna otra columna: LightScheduler siembra
+     *       muchas a la vez en paralelo y encola los bordes después con enqueueColumnBorders().
+     */
+    void LightEngine::seedColumn(int chunkX, int chunkZ){
+        ChunkColumn* column = m_world.getColumn(chunkX, chunkZ);
+        if(column == nullptr){
+            return;
+        }
+        const int minSectionY = column->getMinSectionY();
+        const int maxSectionY = column->getMaxSectionY();
+        if(minSectionY > maxSectionY){
+            column->setLightReady();
+            return; // Sin secciones: todo es aire a cielo abierto
+        }
+        for(int sy = minSectionY; sy <= maxSectionY; sy++){
+            column->getSection(sy);
+        }
+
+        seedSky(column, minSectionY, maxSectionY);
+        if(hasEmitters()){
+            seedEmitters(column, minSectionY, maxSectionY);
+        }
+        // A partir de aquí la propagación la ve (y las vecinas ya iluminadas pueden entrar en ella)
+        column->setLightReady();
+    }
+
+    void LightEngine::enqueueColumnBorders(int chunkX, int chunkZ){
+        ChunkColumn* column = m_world.getColumn(chunkX, chunkZ);
+        if(column != nullptr && column->getMinSectionY() <= column->getMaxSectionY()){
+            enqueueBorders(column, column->getMinSectionY());
+        }
+    }
+
+    /**
+     * @brief Cielo en vertical a partir del mapa de alturas.
+     *
+     * Las secciones por encima de la superficie más alta quedan uniformes a 15 y el resto empieza
+     * uniforme a 0; después cada columna (x, z) baja desde la sección de la superficie atenuando
+     * según la opacidad hasta llegar a 0. Solo reservan array las secciones con luz mixta.
+     */
+    void LightEngine::seedSky(ChunkColumn* column, int minSectionY, int maxSectionY){
+        int maxSurface = HEIGHT_NONE;
+        for(int lz = 0; lz < CHUNK_SECTION_SIZE; lz++){
+            for(int lx = 0; lx < CHUNK_SECTION_SIZE; lx++){
+                maxSurface = std::max(maxSurface, column->getHeight(HEIGHTMAP_SURFACE, lx, lz));
+            }
+        }
+        const int topSection = (maxSurface == HEIGHT_NONE)
+            ? minSectionY - 1 : std::min(maxSurface >> CHUNK_SECTION_SIZE_LOG2, maxSectionY);
+
+        for(int sy = minSectionY; sy <= maxSectionY; sy++){
+            ChunkSection* section = column->findSection(sy);
+            section->getLightArray(LIGHT_SKY).fill(sy > topSection ? LIGHT_MAX : 0);
+            section->getLightArray(LIGHT_BLOCK).fill(0);
+            section->markDirty(DIRTY_ALL_CUBES, LIGHT_DIRTY_KINDS);
+            column->notifySection(section);
+        }
+
+        uint8_t levels[CHUNK_SECTION_LAYER];
+        std::fill(levels, levels + CHUNK_SECTION_LAYER, LIGHT_MAX);
+        int lit = CHUNK_SECTION_LAYER;
+        m_blocks.resize(CHUNK_SECTION_VOLUME);
+        for(int sy = topSection; sy >= minSectionY && lit > 0; sy--){
+            ChunkSection* section = column->findSection(sy);
+            NibbleArray& sky = section->getLightArray(LIGHT_SKY);
+            const bool uniform = section->isUniform();
+            const uint8_t uniformOpacity = m_registry.getLightOpacity(section->getBlock(0, 0, 0));
+            if(!uniform){
+                section->snapshot(m_blocks.data());
+            }
+            for(int ly = CHUNK_SECTION_MASK; ly >= 0; ly--){
+                const int layer = ly << CHUNK_SECTION_LAYER_LOG2;
+                for(int i = 0; i < CHUNK_SECTION_LAYER; i++){
+                    int level = levels[i];
+                    if(level == 0){
+                        continue;
+                    }
+                    const int opacity = uniform ? uniformOpacity : m_registry.getLightOpacity(m_blocks[layer | i]);
+                    level = std::max(0, spreadLevel(LIGHT_SKY, FACE_NEG_Y, level, opacity));
+                    levels[i] = static_cast<uint8_t>(level);
+                    if(level == 0){
+                        lit--;
+                        continue;
+                    }
+                    sky.set(layer | i, static_cast<uint8_t>(level));
+                }
+            }
+            sky.compact();
+        }
+    }
+
+    bool LightEngine::hasEmitters() const {
+        for(std::size_t state = 0; state < m_registry.getStateCount(); state++){
+            if(m_registry.getLightEmission(static_cast<BlockID>(state)) != 0){
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void LightEngine::seedEmitters(ChunkColumn* column, int minSectionY, int maxSectionY){
+        const int baseX = column->x * CHUNK_SECTION_SIZE, baseZ = column->z * CHUNK_SECTION_SIZE;
+        m_blocks.resize(CHUNK_SECTION_VOLUME);
+        for(int sy = minSectionY; sy <= maxSectionY; sy++){
+            ChunkSection* section = column->findSection(sy);
+            if(section->isEmpty()){
+                continue;
+            }
+            if(section->isUniform()){
+                const BlockID block = section->getBlock(0, 0, 0);
+                if(m_registry.getLightEmission(block) == 0){
+                    continue;
+                }
+                std::fill(m_blocks.begin(), m_blocks.end(), block);
+            }else{
+                section->snapshot(m_blocks.data());
+            }
+            NibbleArray& light = section->getLightArray(LIGHT_BLOCK);
+            for(int i = 0; i < CHUNK_SECTION_VOLUME; i++){
+                const uint8_t emission = m_registry.getLightEmission(m_blocks[i]);
+                if(emission == 0){
+                    continue;
+                }
+                light.set(i, emission);
+                m_addQueue[LIGHT_BLOCK].push_back({baseX + (i & CHUNK_SECTION_MASK),
+                                                   (sy * CHUNK_SECTION_SIZE) + (i >> CHUNK_SECTION_LAYER_LOG2),
+                                                   baseZ + ((i >> CHUNK_SECTION_SIZE_LOG2) & CHUNK_SECTION_MASK),
+                                                   emission});
+            }
+        }
+    }
+
+    /**
+     * @brief Encola las celdas que pueden repartir luz en horizontal tras la siembra vertical.
+     *
+     * - Propias: celdas con cielo por debajo de la superficie de alguna vecina (x, z), la única
+     *   forma de que la luz entre de lado bajo un saliente o en una columna vecina.
+     * - De las columnas vecinas cargadas: su borde con luz que pueda entrar en esta columna.
+     *   Las secciones vecinas uniformes sin luz útil se saltan enteras.
+     */
+    void LightEngine::enqueueBorders(ChunkColumn* column, int minSectionY){
+        const int baseX = column->x * CHUNK_SECTION_SIZE, baseZ = column->z * CHUNK_SECTION_SIZE;
+        const int bottomY = minSectionY * CHUNK_SECTION_SIZE;
+        ChunkColumn* neighbors[4];
+        for(int side = 0; side < 4; side++){
+            neighbors[side] = m_world.getColumn(column->x + SIDE_OFFSETS[side][0], column->z + SIDE_OFFSETS[side][1]);
+            if(neighbors[side] != nullptr && !neighbors[side]->isLightReady()){
+                neighbors[side] = nullptr; // Ya entrará su luz cuando se ilumine ella
+            }
+        }
+
+        std::vector<LightNode>& sky = m_addQueue[LIGHT_SKY];
+        for(int lz = 0; lz < CHUNK_SECTION_SIZE; lz++){
+            for(int lx = 0; lx < CHUNK_SECTION_SIZE; lx++){
+                int neighborHeight = HEIGHT_NONE;
+                for(int side = 0; side < 4; side++){
+                    const int nx = lx + SIDE_OFFSETS[side][0], nz = lz + SIDE_OFFSETS[side][1];
+                    if(((nx | nz) & ~CHUNK_SECTION_MASK) == 0){
+                        neighborHeight = std::max(neighborHeight, column->getHeight(HEIGHTMAP_SURFACE, nx, nz));
+                    }else if(neighbors[side] != nullptr){
+                        neighborHeight = std::max(neighborHeight, neighbors[side]->getHeight(
+                            HEIGHTMAP_SURFACE, nx & CHUNK_SECTION_MASK, nz & CHUNK_SECTION_MASK));
+                    }
+                }
+                // La siembra vertical no vuelve a subir: la primera celda a 0 cierra la columna
+                for(int y = neighborHeight; y >= bottomY && neighborHeight != HEIGHT_NONE; y--){
+                    const uint8_t level = readLight(slotAt(baseX + lx, y, baseZ + lz), LIGHT_SKY, baseX + lx, y, baseZ + lz);
+                    if(level == 0){
+                        break;
+                    }
+                    if(level > 1){
+                        sky.push_back({baseX + lx, y, baseZ + lz, level});
+                    }
+                }
+            }
+        }
+
+        for(int side = 0; side < 4; side++){
+            const ChunkColumn* neighbor = neighbors[side];
+            if(neighbor == nullptr){
+                continue;
+            }
+            const bool neighborEmpty = neighbor->getMinSectionY() > neighbor->getMaxSectionY();
+            const int topSection = neighborEmpty ? column->getMaxSectionY()
+                                                 : std::max(column->getMaxSectionY(), neighbor->getMaxSectionY());
+            for(int sy = topSection; sy >= minSectionY; sy--){
+                for(int i = 0; i < CHUNK_SECTION_SIZE; i++){
+                    // Celda propia del borde y la de la vecina que la toca
+                    const int lx = (side == 0) ? 0 : (side == 1) ? CHUNK_SECTION_MASK : i;
+                    const int lz = (side == 2) ? 0 : (side == 3) ? CHUNK_SECTION_MASK : i;
+                    const int nx = baseX + lx + SIDE_OFFSETS[side][0], nz = baseZ + lz + SIDE_OFFSETS[side][1];
+                    const int surface = column->getHeight(HEIGHTMAP_SURFACE, lx, lz);
+                    const SectionSlot& slot = slotAt(nx, sy * CHUNK_SECTION_SIZE, nz);
+                    if(slot.state == SLOT_BLOCKED){
+                        break;
+                    }
+                    if(slot.state == SLOT_SECTION){
+                        const NibbleArray& skyLight = slot.section->getLightArray(LIGHT_SKY);
+                        const NibbleArray& blockLight = slot.section->getLightArray(LIGHT_BLOCK);
+                        if(skyLight.isUniform() && skyLight.getUniformValue() <= 1 &&
+                           blockLight.isUniform() && blockLight.getUniformValue() <= 1){
+                            break;
+                        }
+                    }
+                    for(int ly = CHUNK_SECTION_MASK; ly >= 0; ly--){
+                        const int y = (sy * CHUNK_SECTION_SIZE) + ly;
+                        // Encima de la superficie propia el cielo ya está a 15
+                        const uint8_t skyLevel = (y <= surface) ? readLight(slot, LIGHT_SKY, nx, y, nz) : 0;
+                        if(skyLevel > 1){
+                            sky.push_back({nx, y, nz, skyLevel});
+                        }
+                        const uint8_t blockLevel = readLight(slot, LIGHT_BLOCK, nx, y, nz);
+                        if(blockLevel > 1){
+                            m_addQueue[LIGHT_BLOCK].push_back({nx, y, nz, blockLevel});
+                        }
+                    }
+                }
+            }
+        }
+    }
+
+    /**
+     * @brief Nivel de luz en coordenadas mundiales.
+     *
+     * @return uint8_t Nivel 0-15; sin sección vale el implícito (cielo 15) salvo por debajo de la
+     *         columna o en columnas no cargadas o sin iluminar, donde vale 0.
+     */
+    uint8_t LightEngine::getLight(LightType type, int x, int y, int z) const {
+        EpochGuard guard;
+        const ChunkColumn* column = m_world.getColumn(World::toChunkCoord(x), World::toChunkCoord(z));
+        if(column == nullptr || !column->isLightReady()){
+            return 0;
+        }
+        const int sectionY = y >> CHUNK_SECTION_SIZE_LOG2;
+        const ChunkSection* section = column->findSection(sectionY);
+        if(section != nullptr){
+            return section->getLight(type, World::toLocalCoord(x), y & CHUNK_SECTION_MASK, World::toLocalCoord(z));
+        }
+        if(column->getMinSectionY() > column->getMaxSectionY() || sectionY >= column->getMinSectionY()){
+            return implicitLight(type);
+        }
+        return 0;
+    }
+
+}
@@ -0,0 +1,315 @@
+#include "world/LightScheduler.h"
+#include "world/ColumnMap.h"
+
+namespace AbyssCore {
+
+    // Regiones vecinas en el orden de los lados de LightEngine::getSpills: -X, +X, -Z, +Z
+    static constexpr int REGION_SIDES[4][2] = {{-1, 0}, {1, 0}, {0, -1}, {0, 1}};
+
+    template <typename Queue>
+    static void appendAndClear(Queue& to, Queue& from){
+        to.insert(to.end(), from.begin(), from.end());
+        from.clear();
+    }
+
+    LightScheduler::LightScheduler(World& world, int workerThreads)
+    : m_main(world),
+      m_phase(PHASE_SEED),
+      m_running(0),
+      m_stopping(false) {
+        for(int i = 0; i <= workerThreads; i++){
+            m_engines.push_back(std::make_unique<LightEngine>(world));
+        }
+        for(int i = 1; i <= workerThreads; i++){
+            m_threads.emplace_back(&LightScheduler::workerLoop, this, i);
+        }
+    }
+
+    LightScheduler::~LightScheduler(){
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            m_stopping = true;
+        }
+        m_wake.notify_all();
+        for(std::thread& thread : m_threads){
+            thread.join();
+        }
+    }
+
+    LightScheduler::Region& LightScheduler::regionAt(int regionX, int regionZ){
+        std::unique_ptr<Region>& region = m_regions[packColumnKey(regionX, regionZ)];
+        if(!region){
+            region = std::make_unique<Region>();
+            region->regionX = regionX;
+            region->regionZ = regionZ;
+        }
+        return *region;
+    }
+
+    LightScheduler::Region& LightScheduler::regionOf(int x, int z){
+        return regionAt(World::toChunkCoord(x) >> LIGHT_REGION_SHIFT, World::toChunkCoord(z) >> LIGHT_REGION_SHIFT);
+    }
+
+    void LightScheduler::touch(Region& region){
+        if(!region.touched){
+            region.touched = true;
+            m_touched.push_back(&region);
+        }
+    }
+
+    // Una región en marcha no se encola dos veces: se repite al terminar
+    void LightScheduler::schedule(Region& region){
+        if(region.running){
+            region.rerun = true;
+        }else if(!region.queued){
+            region.queued = true;
+            m_ready.push_back(&region);
+            m_wake.notify_all();
+        }
+    }
+
+    void LightScheduler::requestColumn(int chunkX, int chunkZ){
+        std::lock_guard<std::mutex> lock(m_mutex);
+        Region& region = regionAt(chunkX >> LIGHT_REGION_SHIFT, chunkZ >> LIGHT_REGION_SHIFT);
+        region.columns.emplace_back(chunkX, chunkZ);
+        touch(region);
+    }
+
+    void LightScheduler::setBlock(int x, int y, int z, BlockID block){
+        m_main.setBlock(x, y, z, block);
+    }
+
+    void LightScheduler::onBlockChanged(int x, int y, int z, BlockID oldBlock, BlockID newBlock){
+        m_main.onBlockChanged(x, y, z, oldBlock, newBlock);
+    }
+
+    void LightScheduler::distributeMainQueues(){
+        for(int type = 0; type < LIGHT_TYPE_COUNT; type++){
+            const LightType lightType = static_cast<LightType>(type);
+            for(const LightNode& node : m_main.getRemoveQueue(lightType)){
+                Region& region = regionOf(node.x, node.z);
+                region.pendingRemovals[type].push_back(node);
+                touch(region);
+            }
+            for(const LightNode& node : m_main.getAddQueue(lightType)){
+                Region& region = regionOf(node.x, node.z);
+                region.pendingAdds[type].push_back(node);
+                touch(region);
+            }
+            m_main.getRemoveQueue(lightType).clear();
+            m_main.getAddQueue(lightType).clear();
+        }
+    }
+
+    /**
+     * @brief Procesa todo el trabajo pendiente: siembra, borrados y propagación, en ese orden.
+     *
+     * @note Vuelve cuando ninguna región tiene trabajo; mientras tanto este hilo también procesa regiones.
+     */
+    void LightScheduler::update(){
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            distributeMainQueues();
+            if(m_touched.empty()){
+                return;
+            }
+        }
+        runPhase(PHASE_SEED);
+        runPhase(PHASE_REMOVE);
+        runPhase(PHASE_ADD);
+
+        // Las regiones sin trabajo se borran: el mapa no crece mientras el jugador explora
+        std::lock_guard<std::mutex> lock(m_mutex);
+        for(Region* region : m_touched){
+            region->touched = false;
+            if(isIdle(*region)){
+                m_regions.erase(packColumnKey(region->regionX, region->regionZ));
+            }
+        }
+        m_touched.clear();
+    }
+
+    bool LightScheduler::isIdle(const Region& region){
+        if(region.queued || region.running || !region.columns.empty()){
+            return false;
+        }
+        for(int type = 0; type < LIGHT_TYPE_COUNT; type++){
+            if(!region.pendingRemovals[type].empty() || !region.pendingAdds[type].empty()){
+                return false;
+            }
+            for(int side = 0; side < 4; side++){
+                if(!region.inbox[side][type].empty()){
+                    return false;
+                }
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Ejecuta una fase hasta que no quede ninguna región lista ni en marcha.
+     *
+     * @param phase Fase; solo se encolan al principio las regiones con trabajo para ella, el resto
+     *        entra al recibir reenvíos de sus vecinas.
+     */
+    void LightScheduler::runPhase(Phase phase){
+        std::unique_lock<std::mutex> lock(m_mutex);
+        m_phase = phase;
+        for(Region* region : m_touched){
+            bool work = !region->columns.empty() && phase != PHASE_REMOVE;
+            for(int type = 0; type < LIGHT_TYPE_COUNT; type++){
+                work |= (phase == PHASE_REMOVE && !region->pendingRemovals[type].empty()) ||
+                        (phase == PHASE_ADD && !region->pendingAdds[type].empty());
+            }
+            if(work){
+                schedule(*region);
+            }
+        }
+        for(;;){
+            if(!m_ready.empty()){
+                runReady(lock, *m_engines[0]);
+            }else if(m_running == 0){
+                break;
+            }else{
+                m_wake.wait(lock);
+            }
+        }
+    }
+
+    void LightScheduler::workerLoop(int index){
+        LightEngine& engine = *m_engines[index];
+        std::unique_lock<std::mutex> lock(m_mutex);
+        for(;;){
+            m_wake.wait(lock, [this]{ return m_stopping || !m_ready.empty(); });
+            if(m_stopping){
+                return;
+            }
+            runReady(lock, engine);
+        }
+    }
+
+    void LightScheduler::runReady(std::unique_lock<std::mutex>& lock, LightEngine& engine){
+        Region& region = *m_ready.front();
+        m_ready.pop_front();
+        region.queued = false;
+        region.running = true;
+        m_running++;
+
+        lock.unlock();
+        process(region, engine);
+        deliverSpills(region, engine);
+        lock.lock();
+
+        region.running = false;
+        m_running--;
+        if(region.rerun){
+            region.rerun = false;
+            schedule(region);
+        }
+        // Lo que quede (sumas tras un borrado) se recoge en la fase de propagación
+        for(int type = 0; type < LIGHT_TYPE_COUNT; type++){
+            if(!region.pendingAdds[type].empty()){
+                touch(region);
+            }
+        }
+        if(m_running == 0 && m_ready.empty()){
+            m_wake.notify_all();
+        }
+    }
+
+    /**
+     * @brief Trabajo de una región en la fase actual con el LightEngine del hilo.
+     *
+     * @note Solo este hilo toca la región hasta que termine: sus colas no necesitan lock, salvo
+     *       las bandejas de entrada, en las que escriben las vecinas.
+     */
+    void LightScheduler::process(Region& region, LightEngine& engine){
+        EpochGuard guard;
+        const int chunkX0 = region.regionX * LIGHT_REGION_SIZE, chunkZ0 = region.regionZ * LIGHT_REGION_SIZE;
+        engine.setRegion(chunkX0, chunkZ0, chunkX0 + LIGHT_REGION_SIZE - 1, chunkZ0 + LIGHT_REGION_SIZE - 1);
+
+        const Phase phase = m_phase;
+        for(int side = 0; side < 4; side++){
+            std::lock_guard<std::mutex> lock(region.inboxMutex[side]);
+            for(int type = 0; type < LIGHT_TYPE_COUNT; type++){
+                const LightType lightType = static_cast<LightType>(type);
+                appendAndClear(phase == PHASE_REMOVE ? engine.getRemoveQueue(lightType) : engine.getAddQueue(lightType),
+                               region.inbox[side][type]);
+            }
+        }
+
+        switch(phase){
+            case PHASE_SEED:
+                for(const std::pair<int, int>& column : region.columns){
+                    engine.seedColumn(column.first, column.second);
+                }
+                break;
+            case PHASE_REMOVE:
+                for(int type = 0; type < LIGHT_TYPE_COUNT; type++){
+                    appendAndClear(engine.getRemoveQueue(static_cast<LightType>(type)), region.pendingRemovals[type]);
+                    engine.propagateRemovals(static_cast<LightType>(type));
+                }
+                break;
+            case PHASE_ADD:
+                for(const std::pair<int, int>& column : region.columns){
+                    engine.enqueueColumnBorders(column.first, column.second);
+                }
+                region.columns.clear();
+                for(int type = 0; type < LIGHT_TYPE_COUNT; type++){
+                    appendAndClear(engine.getAddQueue(static_cast<LightType>(type)), region.pendingAdds[type]);
+                    engine.propagateAdds(static_cast<LightType>(type));
+                }
+                break;
+        }
+        // Emisores sembrados y vecinos a repropagar tras un borrado: para la fase de propagación
+        for(int type = 0; type < LIGHT_TYPE_COUNT; type++){
+            appendAndClear(region.pendingAdds[type], engine.getAddQueue(static_cast<LightType>(type)));
+        }
+        engine.flush();
+    }
+
+    /**
+     * @brief Entrega a las regiones vecinas los nodos que salieron de la región y las encola.
+     *
+     * @note Cada vecina guarda lo recibido en la bandeja del lado por el que llega, que solo
+     *       escribe esta región: el mutex de la bandeja solo compite con su consumidor.
+     */
+    void LightScheduler::deliverSpills(const Region& region, LightEngine& engine){
+        Region* targets[4] = {};
+        {
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for(int side = 0; side < 4; side++){
+                for(int type = 0; type < LIGHT_TYPE_COUNT; type++){
+                    if(!engine.getSpills(side, static_cast<LightType>(type)).empty()){
+                        targets[side] = &regionAt(region.regionX + REGION_SIDES[side][0], region.regionZ + REGION_SIDES[side][1]);
+                    }
+                }
+                // En m_touched para que update() la borre al terminar si se queda sin trabajo
+                if(targets[side] != nullptr){
+                    touch(*targets[side]);
+                }
+            }
+        }
+        bool any = false;
+        for(int side = 0; side < 4; side++){
+            if(targets[side] == nullptr){
+                continue;
+            }
+            any = true;
+            // Desde la vecina, esta región está en el lado opuesto
+            std::lock_guard<std::mutex> lock(targets[side]->inboxMutex[side ^ 1]);
+            for(int type = 0; type < LIGHT_TYPE_COUNT; type++){
+                appendAndClear(targets[side]->inbox[side ^ 1][type], engine.getSpills(side, static_cast<LightType>(type)));
+            }
+        }
+        if(any){
+            std::lock_guard<std::mutex> lock(m_mutex);
+            for(Region* target : targets){
+                if(target != nullptr){
+                    schedule(*target);
+                }
+            }
+        }
+    }
+
+}
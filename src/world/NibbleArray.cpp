@@ -0,0 +1,73 @@
+#include "world/NibbleArray.h"
+#include "world/Epoch.h"
+
+namespace AbyssCore {
+
+    // getMemoryUsage() cuenta un byte por cada dos vóxeles
+    static_assert(sizeof(std::atomic<uint8_t>) == 1 && std::atomic<uint8_t>::is_always_lock_free,
+                  "NibbleArray needs lock-free single-byte atomics");
+
+    NibbleArray::NibbleArray(int size, uint8_t uniform)
+    : m_size(size),
+      m_data(nullptr),
+      m_uniform(uniform) {}
+
+    NibbleArray::~NibbleArray(){
+        delete[] m_data.load(std::memory_order_relaxed);
+    }
+
+    /**
+     * @brief Pasa de uniforme a array en el primer set() con un valor distinto.
+     *
+     * @return std::atomic<uint8_t>* Array nuevo, ya relleno con el valor uniforme antes de publicarse.
+     */
+    std::atomic<uint8_t>* NibbleArray::materialize(){
+        const uint8_t uniform = m_uniform.load(std::memory_order_relaxed);
+        std::atomic<uint8_t>* data = new std::atomic<uint8_t>[m_size / 2];
+        for(int i = 0; i < m_size / 2; i++){
+            data[i].store(static_cast<uint8_t>(uniform | (uniform << 4)), std::memory_order_relaxed);
+        }
+        m_data.store(data, std::memory_order_release);
+        return data;
+    }
+
+    void NibbleArray::fill(uint8_t value){
+        m_uniform.store(value, std::memory_order_relaxed);
+        release();
+    }
+
+    /**
+     * @brief Vuelve al modo uniforme si todos los vóxeles tienen el mismo valor.
+     *
+     * @return bool true si el array se ha soltado.
+     */
+    bool NibbleArray::compact(){
+        const std::atomic<uint8_t>* data = m_data.load(std::memory_order_relaxed);
+        if(data == nullptr){
+            return false;
+        }
+        const uint8_t first = data[0].load(std::memory_order_relaxed);
+        if((first & 0xF) != (first >> 4)){
+            return false;
+        }
+        for(int i = 1; i < m_size / 2; i++){
+            if(data[i].load(std::memory_order_relaxed) != first){
+                return false;
+            }
+        }
+        fill(first & 0xF);
+        return true;
+    }
+
+    // El uniforme se publica antes de soltar el array: un lector que vea nullptr lee el valor correcto
+    void NibbleArray::release(){
+        std::atomic<uint8_t>* old = m_data.exchange(nullptr, std::memory_order_acq_rel);
+        if(old != nullptr){
+            EpochManager::getInstance().retireRaw(old, [](void* bytes){ delete[] static_cast<std::atomic<uint8_t>*>(bytes); });
+        }
+    }
+
+    std::size_t NibbleArray::getMemoryUsage() const {
+        return isUniform() ? 0 : static_cast<std::size_t>(m_size / 2);
+    }
+}
@@ -0,0 +1,93 @@
+#include "world/PaddedSnapshot.h"
+#include <algorithm>
+
+namespace AbyssCore {
+
+    PaddedSnapshot::PaddedSnapshot(int padding)
+    : m_padding(std::min(std::max(padding, 0), CHUNK_SECTION_SIZE)),
+      m_dim(CHUNK_SECTION_SIZE + 2 * m_padding),
+      m_chunkX(0), m_sectionY(0), m_chunkZ(0),
+      m_blocks(static_cast<std::size_t>(m_dim) * m_dim * m_dim, 0) {
+        std::fill(m_versions, m_versions + 27, MISSING_SECTION);
+    }
+
+    const ChunkSection* PaddedSnapshot::findSection(const World& world, int chunkX, int sectionY, int chunkZ){
+        const ChunkColumn* column = world.getColumn(chunkX, chunkZ);
+        return (column != nullptr) ? column->findSection(sectionY) : nullptr;
+    }
+
+    /**
+     * @brief Rellena la copia con la sección (chunkX, sectionY, chunkZ) y el borde de sus vecinas.
+     *
+     * Para cada una de las 27 secciones calcula la caja local que cae dentro del cubo acolchado y
+     * la copia con ChunkSection::copyRegion; las secciones inexistentes se rellenan de aire.
+     *
+     * @note Cada sección se visita una vez y su copia es consistente; entre secciones distintas no
+     *       hay atomicidad global, para eso está isStale().
+     */
+    void PaddedSnapshot::extract(const World& world, int chunkX, int sectionY, int chunkZ){
+        EpochGuard guard;
+        m_chunkX = chunkX;
+        m_sectionY = sectionY;
+        m_chunkZ = chunkZ;
+
+        const int strideZ = m_dim;
+        const int strideY = m_dim * m_dim;
+        for(int sy = -1; sy <= 1; sy++){
+            for(int sz = -1; sz <= 1; sz++){
+                for(int sx = -1; sx <= 1; sx++){
+                    // Rango local de la vecina que entra en el cubo, por eje
+                    const int lo[3] = {
+                        sx < 0 ? CHUNK_SECTION_SIZE - m_padding : 0,
+                        sy < 0 ? CHUNK_SECTION_SIZE - m_padding : 0,
+                        sz < 0 ? CHUNK_SECTION_SIZE - m_padding : 0
+                    };
+                    const int hi[3] = {
+                        sx > 0 ? m_padding - 1 : CHUNK_SECTION_MASK,
+                        sy > 0 ? m_padding - 1 : CHUNK_SECTION_MASK,
+                        sz > 0 ? m_padding - 1 : CHUNK_SECTION_MASK
+                    };
+                    const int slot = (sy + 1) * 9 + (sz + 1) * 3 + (sx + 1);
+                    if(lo[0] > hi[0] || lo[1] > hi[1] || lo[2] > hi[2]){
+                        m_versions[slot] = MISSING_SECTION; // padding 0: solo interesa el centro
+                        continue;
+                    }
+
+                    BlockID* out = m_blocks.data() + index(sx * CHUNK_SECTION_SIZE + lo[0],
+                                                          sy * CHUNK_SECTION_SIZE + lo[1],
+                                                          sz * CHUNK_SECTION_SIZE + lo[2]);
+                    const ChunkSection* section = findSection(world, chunkX + sx, sectionY + sy, chunkZ + sz);
+                    if(section == nullptr){
+                        m_versions[slot] = MISSING_SECTION;
+                        for(int y = 0; y <= hi[1] - lo[1]; y++){
+                            for(int z = 0; z <= hi[2] - lo[2]; z++){
+                                std::fill_n(out + y * strideY + z * strideZ, hi[0] - lo[0] + 1, BlockID(0));
+                            }
+                        }
+                        continue;
+                    }
+                    m_versions[slot] = section->copyRegion(lo[0], lo[1], lo[2], hi[0], hi[1], hi[2], out, strideZ, strideY);
+                }
+            }
+        }
+    }
+
+    bool PaddedSnapshot::isStale(const World& world) const {
+        EpochGuard guard;
+        for(int sy = -1; sy <= 1; sy++){
+            for(int sz = -1; sz <= 1; sz++){
+                for(int sx = -1; sx <= 1; sx++){
+                    if(m_padding == 0 && (sx != 0 || sy != 0 || sz != 0)){
+                        continue;
+                    }
+                    const ChunkSection* section = findSection(world, m_chunkX + sx, m_sectionY + sy, m_chunkZ + sz);
+                    const uint64_t version = (section != nullptr) ? section->getVersion() : MISSING_SECTION;
+                    if(version != m_versions[(sy + 1) * 9 + (sz + 1) * 3 + (sx + 1)]){
+                        return true;
+                    }
+                }
+            }
+        }
+        return false;
+    }
+}
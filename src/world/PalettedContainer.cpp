@@ -0,0 +1,398 @@
+#include "world/PalettedContainer.h"
+#include "world/SectionKernels.h"
+
+namespace AbyssCore {
+
+    /**
+     * @brief Calcula el ancho (potencia de 2) necesario para indexar una paleta.
+     *
+     * @param entries Número de entradas que debe poder direccionar el índice.
+     * @return int Bits por bloque dentro del rango [MIN_BITS, MAX_BITS].
+     */
+    static int bitsForEntries(int entries){
+        if(entries <= 1){
+            return PalettedContainer::UNIFORM_BITS;
+        }
+        int bits = PalettedContainer::MIN_BITS;
+        while(bits < PalettedContainer::MAX_BITS && (1 << bits) < entries){
+            bits <<= 1;
+        }
+        return bits;
+    }
+
+    static int log2OfBits(int bits){
+        int log2 = 0;
+        while((1 << log2) < bits){
+            log2++;
+        }
+        return log2;
+    }
+
+    /**
+     * @brief Crea un contenedor uniforme de 'size' vóxeles.
+     *
+     * @param size Número de vóxeles. Debe ser múltiplo de 64 para que las palabras queden completas.
+     * @param fill Bloque con el que se rellena (aire por defecto).
+     * @note No reserva memoria en el heap: el array se crea en el primer set() distinto.
+     */
+    PalettedContainer::PalettedContainer(int size, BlockID fill)
+    : m_size(size),
+      m_bits(UNIFORM_BITS),
+      m_bitsLog2(0),
+      m_mask(0),
+      m_uniformBlock(fill),
+      m_paletteLive(1) {}
+
+    /**
+     * @brief Pasa del modo uniforme a 1 bit por bloque con todos los índices a 0.
+     */
+    void PalettedContainer::materialize(){
+        m_bits = MIN_BITS;
+        m_bitsLog2 = 0;
+        m_mask = 1;
+        m_palette.assign(1, m_uniformBlock);
+        m_refCounts.assign(1, static_cast<uint16_t>(m_size));
+        m_data.assign(static_cast<std::size_t>(m_size) * MIN_BITS / 64, 0);
+    }
+
+    /**
+     * @brief Rellena todo el contenedor con un bloque y libera el array empaquetado.
+     *
+     * @param block Bloque de relleno.
+     */
+    void PalettedContainer::fill(BlockID block){
+        m_bits = UNIFORM_BITS;
+        m_bitsLog2 = 0;
+        m_mask = 0;
+        m_uniformBlock = block;
+        m_paletteLive = 1;
+        std::vector<BlockID>().swap(m_palette);
+        std::vector<uint16_t>().swap(m_refCounts);
+        std::vector<uint16_t>().swap(m_freeSlots);
+        std::vector<uint64_t>().swap(m_data);
+        m_reverse = std::unordered_map<BlockID, uint16_t>();
+    }
+
+    /**
+     * @brief Cambia el bloque de una posición manteniendo la paleta y los contadores.
+     *
+     * En modo uniforme, escribir el mismo bloque no cuesta nada; uno distinto materializa el array.
+     * Libera primero la entrada antigua (para poder reutilizar su hueco) y busca o inserta
+     * el nuevo bloque.
+     *
+     * @param index Índice plano del vóxel.
+     * @param block Bloque nuevo.
+     * @return BlockID Bloque que había antes en la posición.
+     * @note Puede provocar un repack (crecimiento). La reducción la decide quien llama (wantsCompact).
+     */
+    BlockID PalettedContainer::set(int index, BlockID block){
+        if(m_bits == UNIFORM_BITS){
+            if(m_uniformBlock == block){
+                return block;
+            }
+            materialize();
+        }
+
+        const uint32_t oldSlot = readIndex(index);
+        const BlockID oldBlock = m_palette[oldSlot];
+        if(oldBlock == block){
+            return oldBlock;
+        }
+
+        if(--m_refCounts[oldSlot] == 0){
+            m_paletteLive--;
+            m_freeSlots.push_back(static_cast<uint16_t>(oldSlot));
+            if(!m_reverse.empty()){
+                m_reverse.erase(oldBlock);
+            }
+        }
+
+        const int newSlot = findOrInsert(block);
+        writeIndex(index, static_cast<uint32_t>(newSlot));
+        m_refCounts[newSlot]++;
+        return oldBlock;
+    }
+
+    /**
+     * @brief Indica si set(index, block) puede hacerse sin realojar buffers visibles para lectores.
+     *
+     * @param index Índice plano del vóxel.
+     * @param block Bloque nuevo.
+     * @return true si el bloque ya está en la paleta, hay un hueco reutilizable o la paleta
+     *         tiene capacidad reservada dentro del ancho actual.
+     */
+    bool PalettedContainer::canSetInPlace(int index, BlockID block) const {
+        if(m_bits == UNIFORM_BITS){
+            return m_uniformBlock == block;
+        }
+        const uint32_t oldSlot = readIndex(index);
+        if(m_palette[oldSlot] == block || m_refCounts[oldSlot] == 1 || !m_freeSlots.empty()){
+            return true;
+        }
+        if(m_reverse.empty()){
+            for(std::size_t i = 0; i < m_palette.size(); i++){
+                if(m_refCounts[i] != 0 && m_palette[i] == block){
+                    return true;
+                }
+            }
+        }else if(m_reverse.find(block) != m_reverse.end()){
+            return true;
+        }
+        return m_palette.size() < m_palette.capacity() &&
+               static_cast<int>(m_palette.size()) < (1 << m_bits);
+    }
+
+    /**
+     * @brief Decodifica el contenedor completo a un array denso de BlockID.
+     *
+     * @param out Destino con al menos 'size' entradas.
+     * @note Recorre palabra a palabra, sin recalcular desplazamientos por vóxel.
+     */
+    void PalettedContainer::decode(BlockID* out) const {
+        if(m_bits == UNIFORM_BITS){
+            for(int i = 0; i < m_size; i++){
+                out[i] = m_uniformBlock;
+            }
+            return;
+        }
+        const int perWord = 64 >> m_bitsLog2;
+        const std::size_t words = m_data.size();
+        const BlockID* palette = m_palette.data();
+        for(std::size_t w = 0; w < words; w++){
+            uint64_t word = m_data[w];
+            BlockID* dst = out + w * perWord;
+            for(int k = 0; k < perWord; k++){
+                dst[k] = palette[static_cast<uint32_t>(word) & m_mask];
+                word >>= m_bits;
+            }
+        }
+    }
+
+    /**
+     * @brief Devuelve el hueco de paleta del bloque, insertándolo si no existe.
+     *
+     * @param block Bloque a buscar.
+     * @return int Posición en la paleta.
+     * @note Si la paleta está llena duplica el ancho de los índices (1 -> 2 -> 4 -> 8 -> 16).
+     */
+    int PalettedContainer::findOrInsert(BlockID block){
+        if(m_reverse.empty()){
+            for(std::size_t i = 0; i < m_palette.size(); i++){
+                if(m_refCounts[i] != 0 && m_palette[i] == block){
+                    return static_cast<int>(i);
+                }
+            }
+        }else{
+            auto it = m_reverse.find(block);
+            if(it != m_reverse.end()){
+                return it->second;
+            }
+        }
+
+        int slot;
+        if(!m_freeSlots.empty()){
+            slot = m_freeSlots.back();
+            m_freeSlots.pop_back();
+            m_palette[slot] = block;
+        }else{
+            if(static_cast<int>(m_palette.size()) >= (1 << m_bits)){
+                repack(m_bits << 1);
+            }
+            slot = static_cast<int>(m_palette.size());
+            m_palette.push_back(block);
+            m_refCounts.push_back(0);
+        }
+        m_paletteLive++;
+
+        if(!m_reverse.empty()){
+            m_reverse[block] = static_cast<uint16_t>(slot);
+        }else if(static_cast<int>(m_palette.size()) > LINEAR_PALETTE_LIMIT){
+            rebuildReverse();
+        }
+        return slot;
+    }
+
+    /**
+     * @brief Reescribe todos los índices con un nuevo ancho sin tocar la paleta.
+     *
+     * @param newBits Nuevo número de bits por bloque (potencia de 2).
+     */
+    void PalettedContainer::repack(int newBits){
+        const int oldLog2 = m_bitsLog2;
+        const uint32_t oldMask = m_mask;
+        std::vector<uint64_t> oldData;
+        oldData.swap(m_data);
+
+        m_bits = newBits;
+        m_bitsLog2 = log2OfBits(newBits);
+        m_mask = (1u << newBits) - 1u;
+        m_data.assign(static_cast<std::size_t>(m_size) * newBits / 64, 0);
+
+        const int oldPerWordLog2 = 6 - oldLog2;
+        for(int i = 0; i < m_size; i++){
+            const int shift = (i & ((1 << oldPerWordLog2) - 1)) << oldLog2;
+            writeIndex(i, static_cast<uint32_t>(oldData[i >> oldPerWordLog2] >> shift) & oldMask);
+        }
+    }
+
+    /**
+     * @brief Sustituye todo el contenido por el de un array denso.
+     *
+     * Construye la paleta en una pasada y empaqueta con el ancho mínimo. Si solo hay un bloque
+     * distinto el resultado es uniforme.
+     *
+     * @param in Array de 'size' bloques en orden de índice plano.
+     * @note Es el camino de las ediciones masivas: coste O(size) sin repacks intermedios.
+     */
+    void PalettedContainer::encode(const BlockID* in){
+        // Detector de sección uniforme: comparación vectorial antes de construir paleta
+        if(SectionKernels::allEqual(in, m_size)){
+            fill(in[0]);
+            return;
+        }
+
+        std::vector<BlockID> palette;
+        std::vector<uint16_t> refCounts;
+        std::unordered_map<BlockID, uint16_t> reverse;
+        std::vector<uint16_t> slots(m_size);
+
+        BlockID lastBlock = in[0];
+        uint16_t lastSlot = 0;
+        palette.push_back(lastBlock);
+        refCounts.push_back(0);
+        for(int i = 0; i < m_size; i++){
+            const BlockID block = in[i];
+            // Los datos de terreno vienen en rachas: repetir el último hueco evita casi todas las búsquedas
+            if(block != lastBlock){
+                int slot = -1;
+                if(reverse.empty()){
+                    for(std::size_t k = 0; k < palette.size(); k++){
+                        if(palette[k] == block){
+                            slot = static_cast<int>(k);
+                            break;
+                        }
+                    }
+                }else{
+                    auto it = reverse.find(block);
+                    if(it != reverse.end()){
+                        slot = it->second;
+                    }
+                }
+                if(slot < 0){
+                    slot = static_cast<int>(palette.size());
+                    palette.push_back(block);
+                    refCounts.push_back(0);
+                    if(!reverse.empty()){
+                        reverse[block] = static_cast<uint16_t>(slot);
+                    }else if(static_cast<int>(palette.size()) > LINEAR_PALETTE_LIMIT){
+                        for(std::size_t k = 0; k < palette.size(); k++){
+                            reverse[palette[k]] = static_cast<uint16_t>(k);
+                        }
+                    }
+                }
+                lastBlock = block;
+                lastSlot = static_cast<uint16_t>(slot);
+            }
+            slots[i] = lastSlot;
+            refCounts[lastSlot]++;
+        }
+
+        m_bits = bitsForEntries(static_cast<int>(palette.size()));
+        m_bitsLog2 = log2OfBits(m_bits);
+        m_mask = (1u << m_bits) - 1u;
+        m_data.assign(static_cast<std::size_t>(m_size) * m_bits / 64, 0);
+        for(int i = 0; i < m_size; i++){
+            writeIndex(i, slots[i]);
+        }
+        m_palette.swap(palette);
+        m_refCounts.swap(refCounts);
+        std::vector<uint16_t>().swap(m_freeSlots);
+        m_paletteLive = static_cast<int>(m_palette.size());
+        rebuildReverse();
+    }
+
+    /**
+     * @brief Elimina huecos de la paleta y reduce el ancho al mínimo necesario.
+     *
+     * @note Coste O(size). Se invoca automáticamente desde set() y puede llamarse tras ediciones masivas.
+     */
+    void PalettedContainer::compact(){
+        if(m_bits == UNIFORM_BITS){
+            return;
+        }
+        if(m_paletteLive == 1){
+            for(std::size_t i = 0; i < m_palette.size(); i++){
+                if(m_refCounts[i] != 0){
+                    fill(m_palette[i]);
+                    break;
+                }
+            }
+            return;
+        }
+
+        std::vector<uint16_t> remap(m_palette.size(), 0);
+        std::vector<BlockID> palette;
+        std::vector<uint16_t> refCounts;
+        palette.reserve(m_paletteLive);
+        refCounts.reserve(m_paletteLive);
+        for(std::size_t i = 0; i < m_palette.size(); i++){
+            if(m_refCounts[i] != 0){
+                remap[i] = static_cast<uint16_t>(palette.size());
+                palette.push_back(m_palette[i]);
+                refCounts.push_back(m_refCounts[i]);
+            }
+        }
+
+        const int newBits = bitsForEntries(static_cast<int>(palette.size()));
+        std::vector<uint32_t> indices(m_size);
+        for(int i = 0; i < m_size; i++){
+            indices[i] = remap[readIndex(i)];
+        }
+
+        m_bits = newBits;
+        m_bitsLog2 = log2OfBits(newBits);
+        m_mask = (1u << newBits) - 1u;
+        m_data.assign(static_cast<std::size_t>(m_size) * newBits / 64, 0);
+        m_data.shrink_to_fit();
+        for(int i = 0; i < m_size; i++){
+            writeIndex(i, indices[i]);
+        }
+
+        m_palette.swap(palette);
+        m_refCounts.swap(refCounts);
+        std::vector<uint16_t>().swap(m_freeSlots);
+        m_paletteLive = static_cast<int>(m_palette.size());
+        rebuildReverse();
+    }
+
+    void PalettedContainer::rebuildReverse(){
+        if(static_cast<int>(m_palette.size()) <= LINEAR_PALETTE_LIMIT){
+            m_reverse = std::unordered_map<BlockID, uint16_t>(); // Libera también los buckets
+            return;
+        }
+        m_reverse.clear();
+        m_reverse.reserve(m_palette.size());
+        for(std::size_t i = 0; i < m_palette.size(); i++){
+            if(m_refCounts[i] != 0){
+                m_reverse[m_palette[i]] = static_cast<uint16_t>(i);
+            }
+        }
+    }
+
+    /**
+     * @brief Estima los bytes residentes del contenedor (objeto + buffers del heap).
+     *
+     * @return std::size_t Bytes aproximados.
+     * @note El coste del mapa inverso es aproximado (buckets + nodos).
+     */
+    std::size_t PalettedContainer::getMemoryUsage() const {
+        std::size_t bytes = sizeof(*this);
+        bytes += m_palette.capacity() * sizeof(BlockID);
+        bytes += m_refCounts.capacity() * sizeof(uint16_t);
+        bytes += m_freeSlots.capacity() * sizeof(uint16_t);
+        bytes += m_data.capacity() * sizeof(uint64_t);
+        bytes += m_reverse.bucket_count() * sizeof(void*);
+        bytes += m_reverse.size() * (sizeof(BlockID) + sizeof(uint16_t) + 2 * sizeof(void*));
+        return bytes;
+    }
+}
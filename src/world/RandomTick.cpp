@@ -0,0 +1,132 @@
+#include "world/RandomTick.h"
+
+#if defined(__SSE2__)
+    #define ABYSS_TICK_RANDOM_SSE2 1
+    #include <emmintrin.h>
+#else
+    #define ABYSS_TICK_RANDOM_SSE2 0
+#endif
+
+namespace AbyssCore {
+
+    // Bits que consume el índice de un vóxel dentro de la sección
+    static constexpr int SECTION_VOLUME_LOG2 = 3 * CHUNK_SECTION_SIZE_LOG2;
+
+    // Siembra de cada carril con splitmix64: carriles distintos y nunca a 0 (xorshift se quedaría en 0)
+    TickRandom::TickRandom(uint64_t seed){
+        for(int lane = 0; lane < LANES; lane++){
+            seed += 0x9E3779B97F4A7C15ull;
+            uint64_t z = seed;
+            z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+            z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+            z ^= z >> 31;
+            m_state[lane] = static_cast<uint32_t>(z) | 1u;
+        }
+    }
+
+    /**
+     * @brief Avanza todos los carriles count / LANES veces y escribe cada resultado.
+     *
+     * @param out Destino de 'count' números.
+     * @param count Múltiplo de LANES.
+     */
+    void TickRandom::generate(uint32_t* out, int count){
+#if ABYSS_TICK_RANDOM_SSE2
+        __m128i a = _mm_load_si128(reinterpret_cast<const __m128i*>(m_state));
+        __m128i b = _mm_load_si128(reinterpret_cast<const __m128i*>(m_state + 4));
+        for(int i = 0; i < count; i += LANES){
+            a = _mm_xor_si128(a, _mm_slli_epi32(a, 13));
+            b = _mm_xor_si128(b, _mm_slli_epi32(b, 13));
+            a = _mm_xor_si128(a, _mm_srli_epi32(a, 17));
+            b = _mm_xor_si128(b, _mm_srli_epi32(b, 17));
+            a = _mm_xor_si128(a, _mm_slli_epi32(a, 5));
+            b = _mm_xor_si128(b, _mm_slli_epi32(b, 5));
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i), a);
+            _mm_storeu_si128(reinterpret_cast<__m128i*>(out + i + 4), b);
+        }
+        _mm_store_si128(reinterpret_cast<__m128i*>(m_state), a);
+        _mm_store_si128(reinterpret_cast<__m128i*>(m_state + 4), b);
+#else
+        for(int i = 0; i < count; i += LANES){
+            for(int lane = 0; lane < LANES; lane++){
+                uint32_t state = m_state[lane];
+                state ^= state << 13;
+                state ^= state >> 17;
+                state ^= state << 5;
+                m_state[lane] = state;
+                out[i + lane] = state;
+            }
+        }
+#endif
+    }
+
+    RandomTicker::RandomTicker(World& world, uint64_t seed)
+    : m_world(world),
+      m_registry(BlockRegistry::getInstance()),
+      m_tickSpeed(RANDOM_TICKS_PER_VOLUME),
+      m_drawRemainder(0),
+      m_drawsPerSection(0),
+      m_random(seed),
+      m_drawCursor(DRAW_BATCH),
+      m_sectionsSampled(0) {
+    }
+
+    void RandomTicker::setHandler(BlockTypeID type, Handler handler){
+        if(type >= m_handlers.size()){
+            m_handlers.resize(type + 1);
+        }
+        m_handlers[type] = std::move(handler);
+    }
+
+    /**
+     * @brief Un tick: muestrea las secciones con bloques que lo necesitan y llama a sus handlers.
+     *
+     * @note Los handlers ven el estado leído al muestrear; si otro handler del mismo tick ya
+     *       cambió ese bloque, les toca comprobarlo.
+     */
+    void RandomTicker::tick(){
+        m_candidates.clear();
+        m_sectionsSampled = 0;
+        // Sorteos por sección de este tick; lo que no llega a un sorteo entero pasa al siguiente
+        m_drawRemainder += m_tickSpeed * CHUNK_SECTION_VOLUME;
+        m_drawsPerSection = m_drawRemainder / RANDOM_TICK_VOLUME;
+        m_drawRemainder %= RANDOM_TICK_VOLUME;
+        if(m_drawsPerSection == 0){
+            return;
+        }
+        m_world.forEachColumn([this](const ChunkColumn* column){
+            for(int sectionY = column->getMinSectionY(); sectionY <= column->getMaxSectionY(); sectionY++){
+                const ChunkSection* section = column->findSection(sectionY);
+                if(section != nullptr && section->getTickableCount() != 0){
+                    sampleSection(column, section);
+                }
+            }
+        });
+
+        for(const Candidate& candidate : m_candidates){
+            const BlockTypeID type = m_registry.getTypeId(candidate.state);
+            if(type < m_handlers.size() && m_handlers[type]){
+                m_handlers[type](candidate.x, candidate.y, candidate.z, candidate.state, candidate.random);
+            }
+        }
+    }
+
+    void RandomTicker::sampleSection(const ChunkColumn* column, const ChunkSection* section){
+        m_sectionsSampled++;
+        const int baseX = column->x * CHUNK_SECTION_SIZE;
+        const int baseY = section->getYIndex() * CHUNK_SECTION_SIZE;
+        const int baseZ = column->z * CHUNK_SECTION_SIZE;
+        for(int i = 0; i < m_drawsPerSection; i++){
+            // Bits bajos: índice en orden sectionIndex; el resto queda para el handler
+            const uint32_t draw = nextDraw();
+            const int x = draw & CHUNK_SECTION_MASK;
+            const int z = (draw >> CHUNK_SECTION_SIZE_LOG2) & CHUNK_SECTION_MASK;
+            const int y = (draw >> CHUNK_SECTION_LAYER_LOG2) & CHUNK_SECTION_MASK;
+            const BlockID state = section->getBlock(x, y, z);
+            if(m_registry.ticksRandomly(state)){
+                m_candidates.push_back({baseX + x, baseY + y, baseZ + z, state, draw >> SECTION_VOLUME_LOG2});
+            }
+        }
+    }
+
+}
@@ -0,0 +1,201 @@
+#include "world/Raycast.h"
+#include <cmath>
+#include <climits>
+#include <limits>
+#include <algorithm>
+
+namespace AbyssCore {
+
+    Raycaster::Raycaster(const World& world, RayFilter filter)
+    : m_world(world),
+      m_registry(BlockRegistry::getInstance()),
+      m_filter(filter),
+      m_chunkX(INT_MIN),
+      m_chunkZ(INT_MIN),
+      m_column(nullptr),
+      m_visited(0) {}
+
+    bool Raycaster::stops(BlockID block) const {
+        switch(m_filter){
+            case RAY_HIT_ANY:
+                return block != 0;
+            case RAY_HIT_SOLID:
+                return m_registry.getCollisionShape(block) != SHAPE_EMPTY;
+            case RAY_HIT_OPAQUE:
+                return !m_registry.isTransparent(block);
+        }
+        return block != 0;
+    }
+
+    // Los rayos de un lote suelen empezar en la misma columna: se conserva entre rayos
+    const ChunkColumn* Raycaster::columnAt(int chunkX, int chunkZ){
+        if(chunkX != m_chunkX || chunkZ != m_chunkZ){
+            m_chunkX = chunkX;
+            m_chunkZ = chunkZ;
+            m_column = m_world.getColumn(chunkX, chunkZ);
+        }
+        return m_column;
+    }
+
+    /**
+     * @brief Lanza un rayo y devuelve el primer bloque que lo detiene según el filtro.
+     *
+     * @param ray Origen, dirección y distancia máxima en bloques.
+     * @return RayHit hit = false si no encuentra nada antes de maxDistance. Con origen o dirección
+     *         no finitos, o |origen| > RAY_MAX_COORD, no alcanza nada.
+     * @note Dentro de una sección con bloques avanza vóxel a vóxel; una sección que no puede
+     *       detener el rayo se cruza calculando directamente cuántos vóxeles avanza cada eje
+     *       hasta el primer borde de sección, sin visitarlos.
+     */
+    RayHit Raycaster::cast(const Ray& ray){
+        RayHit result{false, 0, 0, 0, -1, 0, 0.0f};
+        for(int axis = 0; axis < 3; axis++){
+            if(!std::isfinite(ray.direction[axis]) || !(std::fabs(ray.origin[axis]) <= RAY_MAX_COORD)){
+                return result;
+            }
+        }
+        if(!(ray.maxDistance >= 0.0f)){
+            return result;
+        }
+        const double length = std::sqrt(double(ray.direction[0]) * ray.direction[0] +
+                                        double(ray.direction[1]) * ray.direction[1] +
+                                        double(ray.direction[2]) * ray.direction[2]);
+        if(length == 0.0){
+            return result;
+        }
+
+        constexpr double INF = std::numeric_limits<double>::infinity();
+        int voxel[3], step[3];
+        double tMax[3], tDelta[3];
+        for(int axis = 0; axis < 3; axis++){
+            const double origin = ray.origin[axis];
+            const double dir = ray.direction[axis] / length;
+            voxel[axis] = static_cast<int>(std::floor(origin));
+            if(dir > 0.0){
+                step[axis] = 1;
+                tDelta[axis] = 1.0 / dir;
+                tMax[axis] = (voxel[axis] + 1 - origin) / dir;
+            }else if(dir < 0.0){
+                step[axis] = -1;
+                tDelta[axis] = -1.0 / dir;
+                tMax[axis] = (voxel[axis] - origin) / dir;
+            }else{
+                step[axis] = 0;
+                tDelta[axis] = INF;
+                tMax[axis] = INF;
+            }
+        }
+
+        const double maxDistance = std::min(ray.maxDistance, RAY_MAX_DISTANCE);
+        // Fuera de esta caja no hay columnas: una sección ahí solo se cruza si el rayo vuelve hacia ella
+        int minChunkX, minChunkZ, maxChunkX, maxChunkZ;
+        if(!m_world.getColumnBounds(minChunkX, minChunkZ, maxChunkX, maxChunkZ)){
+            return result;
+        }
+        const bool vertical = (step[0] == 0 && step[2] == 0);
+        double t = 0.0;
+        int enteredAxis = -1;
+        int sectionX = INT_MIN, sectionY = INT_MIN, sectionZ = INT_MIN;
+        const ChunkSection* section = nullptr;
+        bool skippable = true;
+
+        for(;;){
+            const int sx = voxel[0] >> CHUNK_SECTION_SIZE_LOG2;
+            const int sy = voxel[1] >> CHUNK_SECTION_SIZE_LOG2;
+            const int sz = voxel[2] >> CHUNK_SECTION_SIZE_LOG2;
+            if(sx != sectionX || sy != sectionY || sz != sectionZ){
+                sectionX = sx;
+                sectionY = sy;
+                sectionZ = sz;
+                if((sx < minChunkX && step[0] <= 0) || (sx > maxChunkX && step[0] >= 0) ||
+                   (sz < minChunkZ && step[2] <= 0) || (sz > maxChunkZ && step[2] >= 0)){
+                    return result;
+                }
+                const ChunkColumn* column = columnAt(sx, sz);
+                // Un rayo vertical no cambia de columna: por encima o por debajo de sus secciones ya no hay nada
+                if(vertical && (column == nullptr || (step[1] > 0 && sy > column->getMaxSectionY()) ||
+                                (step[1] < 0 && sy < column->getMinSectionY()))){
+                    return result;
+                }
+                section = (column != nullptr) ? column->findSection(sy) : nullptr;
+                if(section == nullptr || section->isEmpty()){
+                    skippable = true;
+                }else{
+                    skippable = section->isUniform() && !stops(section->getBlock(0, 0, 0));
+                }
+            }
+
+            const int local[3] = {
+                voxel[0] & CHUNK_SECTION_MASK, voxel[1] & CHUNK_SECTION_MASK, voxel[2] & CHUNK_SECTION_MASK
+            };
+
+            if(skippable){
+                // Instante en que cada eje sale de la sección: vóxeles que le quedan dentro * tDelta
+                int remaining[3];
+                double exitT[3];
+                int exitAxis = 0;
+                for(int axis = 0; axis < 3; axis++){
+                    remaining[axis] = (step[axis] > 0) ? CHUNK_SECTION_MASK - local[axis] : local[axis];
+                    exitT[axis] = (step[axis] != 0) ? tMax[axis] + remaining[axis] * tDelta[axis] : INF;
+                    if(exitT[axis] < exitT[exitAxis]){
+                        exitAxis = axis;
+                    }
+                }
+                t = exitT[exitAxis];
+                if(t > maxDistance){
+                    return result;
+                }
+                // Cada eje avanza los bordes de vóxel que cruza antes de t, sin salir de la sección
+                for(int axis = 0; axis < 3; axis++){
+                    int crossed;
+                    if(axis == exitAxis){
+                        crossed = remaining[axis] + 1;
+                    }else if(step[axis] == 0 || tMax[axis] > t){
+                        crossed = 0;
+                    }else{
+                        crossed = static_cast<int>(std::floor((t - tMax[axis]) / tDelta[axis])) + 1;
+                        crossed = (crossed > remaining[axis]) ? remaining[axis] : crossed;
+                    }
+                    if(crossed != 0){ // Un eje parado tiene tDelta infinito: 0 * inf daría NaN
+                        voxel[axis] += crossed * step[axis];
+                        tMax[axis] += crossed * tDelta[axis];
+                    }
+                }
+                enteredAxis = exitAxis;
+                continue;
+            }
+
+            const BlockID block = section->getBlock(local[0], local[1], local[2]);
+            m_visited++;
+            if(stops(block)){
+                result.hit = true;
+                result.x = voxel[0];
+                result.y = voxel[1];
+                result.z = voxel[2];
+                // Entrar avanzando en +eje es cruzar la cara negativa del bloque
+                result.face = (enteredAxis < 0) ? -1 : enteredAxis * 2 + (step[enteredAxis] > 0 ? 0 : 1);
+                result.block = block;
+                result.distance = static_cast<float>(t);
+                return result;
+            }
+
+            // Paso DDA: el eje cuyo siguiente borde está más cerca
+            int axis = (tMax[0] < tMax[1]) ? 0 : 1;
+            axis = (tMax[2] < tMax[axis]) ? 2 : axis;
+            t = tMax[axis];
+            if(t > maxDistance){
+                return result;
+            }
+            voxel[axis] += step[axis];
+            tMax[axis] += tDelta[axis];
+            enteredAxis = axis;
+        }
+    }
+
+    void Raycaster::castBatch(const Ray* rays, int count, RayHit* hits){
+        for(int i = 0; i < count; i++){
+            hits[i] = cast(rays[i]);
+        }
+    }
+
+}
@@ -0,0 +1,170 @@
+#include "world/ScheduledTick.h"
+#include <algorithm>
+#include <climits>
+
+namespace AbyssCore {
+
+    static constexpr uint64_t NO_WAKEUP = UINT64_MAX;
+
+    // Clave de un tick dentro de su columna: Y en los 32 bits altos, tipo, Z y X locales en los bajos
+    static uint64_t packTickKey(int localX, int y, int localZ, BlockTypeID type){
+        return (static_cast<uint64_t>(static_cast<uint32_t>(y)) << 32) | (static_cast<uint64_t>(type) << 10) |
+               static_cast<uint64_t>(localZ << 5) | static_cast<uint64_t>(localX);
+    }
+
+    // Ticks pendientes de una columna
+    struct TickScheduler::ColumnTicks {
+        struct Entry {
+            uint64_t due;
+            uint64_t sequence;
+            uint64_t key;
+        };
+        // Orden del montículo: el primero es el que vence antes (y a igualdad, el que llegó antes)
+        static bool later(const Entry& a, const Entry& b){
+            return a.due > b.due || (a.due == b.due && a.sequence > b.sequence);
+        }
+
+        uint64_t loadId;                // Columna para la que se creó
+        std::vector<Entry> heap;
+        TickKeySet pending;
+        uint64_t wakeup = NO_WAKEUP;    // Vencimiento del aviso vigente en m_wakeups
+    };
+
+    TickScheduler::TickScheduler(World& world)
+    : m_world(world),
+      m_budget(SCHEDULED_TICK_BUDGET),
+      m_currentTick(0),
+      m_sequence(0),
+      m_executed(0) {
+    }
+
+    TickScheduler::~TickScheduler() = default;
+
+    void TickScheduler::setHandler(BlockTypeID type, Handler handler){
+        if(type >= m_handlers.size()){
+            m_handlers.resize(type + 1);
+        }
+        m_handlers[type] = std::move(handler);
+    }
+
+    // Deja un aviso si este vencimiento es anterior al que ya tenía la columna
+    void TickScheduler::wake(ColumnTicks& column, uint64_t columnKey, uint64_t due){
+        if(due < column.wakeup){
+            column.wakeup = due;
+            m_wakeups.push({due, columnKey});
+        }
+    }
+
+    /**
+     * @brief Programa un tick de bloque.
+     *
+     * @param type Tipo cuyo handler se llamará (normalmente el del bloque en esa posición).
+     * @param delay Ticks de espera; menos de 1 cuenta como 1.
+     * @return bool false si (posición, tipo) ya estaba pendiente o la columna no está cargada.
+     */
+    bool TickScheduler::schedule(int x, int y, int z, BlockTypeID type, int delay){
+        const int chunkX = World::toChunkCoord(x), chunkZ = World::toChunkCoord(z);
+        const uint64_t loadId = loadIdOf(chunkX, chunkZ);
+        if(loadId == 0){
+            return false;
+        }
+        const uint64_t columnKey = packColumnKey(chunkX, chunkZ);
+        std::unique_ptr<ColumnTicks>& column = m_columns[columnKey];
+        // Sin bloque, o con el de una carga anterior de la columna: se empieza de cero
+        if(!column || column->loadId != loadId){
+            column = std::make_unique<ColumnTicks>();
+            column->loadId = loadId;
+        }
+        const uint64_t key = packTickKey(World::toLocalCoord(x), y, World::toLocalCoord(z), type);
+        if(!column->pending.insert(key)){
+            return false;
+        }
+        const uint64_t due = m_currentTick + static_cast<uint64_t>(std::max(delay, 1));
+        column->heap.push_back({due, m_sequence++, key});
+        std::push_heap(column->heap.begin(), column->heap.end(), ColumnTicks::later);
+        wake(*column, columnKey, due);
+        return true;
+    }
+
+    bool TickScheduler::isScheduled(int x, int y, int z, BlockTypeID type) const {
+        const int chunkX = World::toChunkCoord(x), chunkZ = World::toChunkCoord(z);
+        const auto it = m_columns.find(packColumnKey(chunkX, chunkZ));
+        return it != m_columns.end() && it->second->loadId == loadIdOf(chunkX, chunkZ) &&
+               it->second->pending.contains(packTickKey(World::toLocalCoord(x), y, World::toLocalCoord(z), type));
+    }
+
+    uint64_t TickScheduler::loadIdOf(int chunkX, int chunkZ) const {
+        EpochGuard guard;
+        const ChunkColumn* column = m_world.getColumn(chunkX, chunkZ);
+        return (column != nullptr) ? column->loadId : 0;
+    }
+
+    void TickScheduler::dropColumn(int chunkX, int chunkZ){
+        m_columns.erase(packColumnKey(chunkX, chunkZ));
+    }
+
+    std::size_t TickScheduler::getPendingCount() const {
+        std::size_t count = 0;
+        for(const auto& entry : m_columns){
+            count += entry.second->heap.size();
+        }
+        return count;
+    }
+
+    /**
+     * @brief Avanza un tick y ejecuta los ticks vencidos por orden de vencimiento (y de llegada
+     *        dentro de cada columna).
+     *
+     * @note Cada columna se vacía de vencidos antes de llamar a sus handlers, que pueden programar
+     *       más ticks o descargar columnas. Si se agota el presupuesto, lo que queda conserva su
+     *       vencimiento y sale primero en el tick siguiente.
+     */
+    void TickScheduler::tick(){
+        m_currentTick++;
+        m_executed = 0;
+        while(!m_wakeups.empty() && m_wakeups.top().due <= m_currentTick && m_executed < m_budget){
+            const Wakeup wakeup = m_wakeups.top();
+            m_wakeups.pop();
+            const auto it = m_columns.find(wakeup.columnKey);
+            if(it == m_columns.end() || it->second->wakeup != wakeup.due){
+                continue;   // Columna descargada o aviso sustituido por uno anterior
+            }
+            const int chunkX = static_cast<int32_t>(wakeup.columnKey >> 32);
+            const int chunkZ = static_cast<int32_t>(wakeup.columnKey & 0xFFFFFFFFu);
+            if(loadIdOf(chunkX, chunkZ) != it->second->loadId){
+                m_columns.erase(it);    // Descargada (y quizá recargada) sin pasar por dropColumn
+                continue;
+            }
+
+            ColumnTicks& column = *it->second;
+            column.wakeup = NO_WAKEUP;
+            // Solo hasta el vencimiento de la siguiente columna: el orden global se mantiene por vencimiento
+            const uint64_t limit = m_wakeups.empty() ? m_currentTick : std::min(m_currentTick, m_wakeups.top().due);
+            m_due.clear();
+            while(!column.heap.empty() && column.heap.front().due <= limit &&
+                  m_executed + static_cast<int>(m_due.size()) < m_budget){
+                std::pop_heap(column.heap.begin(), column.heap.end(), ColumnTicks::later);
+                const uint64_t key = column.heap.back().key;
+                column.heap.pop_back();
+                column.pending.erase(key);
+                m_due.push_back({chunkX * CHUNK_SECTION_SIZE + static_cast<int>(key & 31),
+                                 static_cast<int32_t>(key >> 32),
+                                 chunkZ * CHUNK_SECTION_SIZE + static_cast<int>((key >> 5) & 31),
+                                 static_cast<BlockTypeID>(key >> 10)});
+            }
+            if(column.heap.empty()){
+                m_columns.erase(it);
+            }else{
+                wake(column, wakeup.columnKey, column.heap.front().due);
+            }
+
+            m_executed += static_cast<int>(m_due.size());
+            for(const DueTick& due : m_due){
+                if(due.type < m_handlers.size() && m_handlers[due.type]){
+                    m_handlers[due.type](due.x, due.y, due.z, due.type);
+                }
+            }
+        }
+    }
+
+}
@@ -0,0 +1,344 @@
+#include "world/SectionKernels.h"
+#include "world/ChunkSection.h"
+#include <atomic>
+#include <algorithm>
+
+#if (defined(__x86_64__) || defined(__i386__)) && (defined(__GNUC__) || defined(__clang__))
+    #define ABYSS_KERNELS_X86 1
+    #include <immintrin.h>
+#else
+    #define ABYSS_KERNELS_X86 0
+#endif
+
+namespace AbyssCore {
+namespace SectionKernels {
+
+    // Tabla de variantes; se publica una vez y después solo se lee
+    struct KernelTable {
+        Isa isa;
+        int (*countNonAir)(const BlockID*, int);
+        bool (*allEqual)(const BlockID*, int);
+        int (*histogram)(const BlockID*, int, uint32_t*, BlockID);
+        void (*highestNonAir)(const BlockID*, int, int8_t*);
+    };
+
+    // ------------------------------------------------------------------
+    // Escalar (referencia y fallback)
+    // ------------------------------------------------------------------
+    static int countNonAirScalar(const BlockID* blocks, int count){
+        int nonAir = 0;
+        for(int i = 0; i < count; i++){
+            nonAir += (blocks[i] != 0);
+        }
+        return nonAir;
+    }
+
+    static bool allEqualScalar(const BlockID* blocks, int count){
+        for(int i = 1; i < count; i++){
+            if(blocks[i] != blocks[0]){
+                return false;
+            }
+        }
+        return true;
+    }
+
+    static int histogramScalar(const BlockID* blocks, int count, uint32_t* counts, BlockID numIds){
+        int outOfRange = 0;
+        for(int i = 0; i < count; i++){
+            if(blocks[i] < numIds){
+                counts[blocks[i]]++;
+            }else{
+                outOfRange++;
+            }
+        }
+        return outOfRange;
+    }
+
+    /**
+     * @brief Altura máxima no aire por columna recorriendo de arriba abajo.
+     *
+     * @note Termina en cuanto todas las columnas tienen altura: en secciones de superficie
+     *       suele bastar con unas pocas capas.
+     */
+    static void highestNonAirScalar(const BlockID* section, int size, int8_t* heights){
+        const int layer = size * size;
+        int pending = layer;
+        for(int i = 0; i < layer; i++){
+            heights[i] = -1;
+        }
+        for(int y = size - 1; y >= 0 && pending > 0; y--){
+            const BlockID* row = section + y * layer;
+            for(int i = 0; i < layer; i++){
+                if(heights[i] < 0 && row[i] != 0){
+                    heights[i] = static_cast<int8_t>(y);
+                    pending--;
+                }
+            }
+        }
+    }
+
+#if ABYSS_KERNELS_X86
+    // ------------------------------------------------------------------
+    // SSE4.1 (4 bloques por registro)
+    // ------------------------------------------------------------------
+    __attribute__((target("sse4.1")))
+    static int countNonAirSSE41(const BlockID* blocks, int count){
+        const __m128i zero = _mm_setzero_si128();
+        __m128i airLanes = _mm_setzero_si128();
+        int i = 0;
+        for(; i + 4 <= count; i += 4){
+            const __m128i v = _mm_loadu_si128(reinterpret_cast<const __m128i*>(blocks + i));
+            airLanes = _mm_sub_epi32(airLanes, _mm_cmpeq_epi32(v, zero)); // cmpeq da -1 por carril
+        }
+        alignas(16) int32_t lanes[4];
+        _mm_store_si128(reinterpret_cast<__m128i*>(lanes), airLanes);
+        const int air = lanes[0] + lanes[1] + lanes[2] + lanes[3];
+        return (i - air) + countNonAirScalar(blocks + i, count - i);
+    }
+
+    __attribute__((target("sse4.1")))
+    static bool allEqualSSE41(const BlockID* blocks, int count){
+        const __m128i first = _mm_set1_epi32(static_cast<int>(blocks[0]));
+        int i = 0;
+        for(; i + 16 <= count; i += 16){
+            const __m128i* p = reinterpret_cast<const __m128i*>(blocks + i);
+            __m128i diff = _mm_xor_si128(_mm_loadu_si128(p), first);
+            diff = _mm_or_si128(diff, _mm_xor_si128(_mm_loadu_si128(p + 1), first));
+            diff = _mm_or_si128(diff, _mm_xor_si128(_mm_loadu_si128(p + 2), first));
+            diff = _mm_or_si128(diff, _mm_xor_si128(_mm_loadu_si128(p + 3), first));
+            if(!_mm_testz_si128(diff, diff)){
+                return false;
+            }
+        }
+        for(; i < count; i++){
+            if(blocks[i] != blocks[0]){
+                return false;
+            }
+        }
+        return true;
+    }
+
+    __attribute__((target("sse4.1")))
+    static void highestNonAirSSE41(const BlockID* section, int size, int8_t* heights){
+        const int layer = size * size;
+        // best vive en la pila: como mucho una capa de sección (4 KB a 32^3)
+        if(layer % 4 != 0 || layer > CHUNK_SECTION_LAYER){
+            highestNonAirScalar(section, size, heights);
+            return;
+        }
+        alignas(32) int32_t best[CHUNK_SECTION_LAYER];
+        std::fill_n(best, layer, -1);
+        const __m128i zero = _mm_setzero_si128();
+        const __m128i none = _mm_set1_epi32(-1);
+        for(int y = size - 1; y >= 0; y--){
+            const BlockID* row = section + y * layer;
+            const __m128i yv = _mm_set1_epi32(y);
+            __m128i unresolved = _mm_setzero_si128();
+            for(int i = 0; i < layer; i += 4){
+                __m128i* dst = reinterpret_cast<__m128i*>(best + i);
+                const __m128i h = _mm_loadu_si128(dst);
+                const __m128i solid = _mm_andnot_si128(
+                    _mm_cmpeq_epi32(_mm_loadu_si128(reinterpret_cast<const __m128i*>(row + i)), zero), none);
+                const __m128i take = _mm_and_si128(solid, _mm_cmpeq_epi32(h, none));
+                const __m128i updated = _mm_blendv_epi8(h, yv, take);
+                _mm_storeu_si128(dst, updated);
+                unresolved = _mm_or_si128(unresolved, _mm_cmpeq_epi32(updated, none));
+            }
+            if(_mm_testz_si128(unresolved, unresolved)){
+                break;
+            }
+        }
+        for(int i = 0; i < layer; i++){
+            heights[i] = static_cast<int8_t>(best[i]);
+        }
+    }
+
+    // ------------------------------------------------------------------
+    // AVX2 (8 bloques por registro)
+    // ------------------------------------------------------------------
+    __attribute__((target("avx2")))
+    static int countNonAirAVX2(const BlockID* blocks, int count){
+        const __m256i zero = _mm256_setzero_si256();
+        __m256i airLanes = _mm256_setzero_si256();
+        int i = 0;
+        for(; i + 8 <= count; i += 8){
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks + i));
+            airLanes = _mm256_sub_epi32(airLanes, _mm256_cmpeq_epi32(v, zero));
+        }
+        alignas(32) int32_t lanes[8];
+        _mm256_store_si256(reinterpret_cast<__m256i*>(lanes), airLanes);
+        int air = 0;
+        for(int k = 0; k < 8; k++){
+            air += lanes[k];
+        }
+        return (i - air) + countNonAirScalar(blocks + i, count - i);
+    }
+
+    __attribute__((target("avx2")))
+    static bool allEqualAVX2(const BlockID* blocks, int count){
+        const __m256i first = _mm256_set1_epi32(static_cast<int>(blocks[0]));
+        int i = 0;
+        for(; i + 32 <= count; i += 32){
+            const __m256i* p = reinterpret_cast<const __m256i*>(blocks + i);
+            __m256i diff = _mm256_xor_si256(_mm256_loadu_si256(p), first);
+            diff = _mm256_or_si256(diff, _mm256_xor_si256(_mm256_loadu_si256(p + 1), first));
+            diff = _mm256_or_si256(diff, _mm256_xor_si256(_mm256_loadu_si256(p + 2), first));
+            diff = _mm256_or_si256(diff, _mm256_xor_si256(_mm256_loadu_si256(p + 3), first));
+            if(!_mm256_testz_si256(diff, diff)){
+                return false;
+            }
+        }
+        for(; i < count; i++){
+            if(blocks[i] != blocks[0]){
+                return false;
+            }
+        }
+        return true;
+    }
+
+    /**
+     * @brief Histograma con atajo para rachas: si 8 bloques seguidos son iguales se suman de una vez.
+     *
+     * @note No existe un histograma vectorial general en AVX2 (no hay detección de conflictos);
+     *       el terreno generado tiene rachas largas y este atajo es lo que acelera el caso real.
+     */
+    __attribute__((target("avx2")))
+    static int histogramAVX2(const BlockID* blocks, int count, uint32_t* counts, BlockID numIds){
+        int outOfRange = 0;
+        int i = 0;
+        for(; i + 8 <= count; i += 8){
+            const __m256i v = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(blocks + i));
+            const __m256i first = _mm256_set1_epi32(static_cast<int>(blocks[i]));
+            if(_mm256_movemask_epi8(_mm256_cmpeq_epi32(v, first)) == -1){
+                if(blocks[i] < numIds){
+                    counts[blocks[i]] += 8;
+                }else{
+                    outOfRange += 8;
+                }
+            }else{
+                outOfRange += histogramScalar(blocks + i, 8, counts, numIds);
+            }
+        }
+        return outOfRange + histogramScalar(blocks + i, count - i, counts, numIds);
+    }
+
+    __attribute__((target("avx2")))
+    static void highestNonAirAVX2(const BlockID* section, int size, int8_t* heights){
+        const int layer = size * size;
+        // best vive en la pila: como mucho una capa de sección (4 KB a 32^3)
+        if(layer % 8 != 0 || layer > CHUNK_SECTION_LAYER){
+            highestNonAirSSE41(section, size, heights);
+            return;
+        }
+        alignas(32) int32_t best[CHUNK_SECTION_LAYER];
+        std::fill_n(best, layer, -1);
+        const __m256i zero = _mm256_setzero_si256();
+        const __m256i none = _mm256_set1_epi32(-1);
+        for(int y = size - 1; y >= 0; y--){
+            const BlockID* row = section + y * layer;
+            const __m256i yv = _mm256_set1_epi32(y);
+            __m256i unresolved = _mm256_setzero_si256();
+            for(int i = 0; i < layer; i += 8){
+                __m256i* dst = reinterpret_cast<__m256i*>(best + i);
+                const __m256i h = _mm256_loadu_si256(dst);
+                const __m256i solid = _mm256_andnot_si256(
+                    _mm256_cmpeq_epi32(_mm256_loadu_si256(reinterpret_cast<const __m256i*>(row + i)), zero), none);
+                const __m256i take = _mm256_and_si256(solid, _mm256_cmpeq_epi32(h, none));
+                const __m256i updated = _mm256_blendv_epi8(h, yv, take);
+                _mm256_storeu_si256(dst, updated);
+                unresolved = _mm256_or_si256(unresolved, _mm256_cmpeq_epi32(updated, none));
+            }
+            if(_mm256_testz_si256(unresolved, unresolved)){
+                break;
+            }
+        }
+        for(int i = 0; i < layer; i++){
+            heights[i] = static_cast<int8_t>(best[i]);
+        }
+    }
+#endif
+
+    static const KernelTable SCALAR_TABLE = {
+        Isa::Scalar, countNonAirScalar, allEqualScalar, histogramScalar, highestNonAirScalar
+    };
+#if ABYSS_KERNELS_X86
+    static const KernelTable SSE41_TABLE = {
+        Isa::SSE41, countNonAirSSE41, allEqualSSE41, histogramScalar, highestNonAirSSE41
+    };
+    static const KernelTable AVX2_TABLE = {
+        Isa::AVX2, countNonAirAVX2, allEqualAVX2, histogramAVX2, highestNonAirAVX2
+    };
+#endif
+
+    static const KernelTable* tableFor(Isa isa){
+#if ABYSS_KERNELS_X86
+        const Isa best = detectIsa();
+        if(isa == Isa::AVX2 && best == Isa::AVX2){
+            return &AVX2_TABLE;
+        }
+        if(isa != Isa::Scalar && best != Isa::Scalar){
+            return &SSE41_TABLE;
+        }
+#else
+        (void)isa;
+#endif
+        return &SCALAR_TABLE;
+    }
+
+    static std::atomic<const KernelTable*> s_active(nullptr);
+
+    static const KernelTable& active(){
+        const KernelTable* table = s_active.load(std::memory_order_acquire);
+        if(table == nullptr){
+            table = tableFor(detectIsa());
+            s_active.store(table, std::memory_order_release);
+        }
+        return *table;
+    }
+
+    Isa detectIsa(){
+#if ABYSS_KERNELS_X86
+        __builtin_cpu_init();
+        if(__builtin_cpu_supports("avx2")){
+            return Isa::AVX2;
+        }
+        if(__builtin_cpu_supports("sse4.1")){
+            return Isa::SSE41;
+        }
+#endif
+        return Isa::Scalar;
+    }
+
+    Isa getIsa(){
+        return active().isa;
+    }
+
+    void setIsa(Isa isa){
+        s_active.store(tableFor(isa), std::memory_order_release);
+    }
+
+    const char* isaName(Isa isa){
+        switch(isa){
+            case Isa::AVX2: return "avx2";
+            case Isa::SSE41: return "sse4.1";
+            default: return "scalar";
+        }
+    }
+
+    int countNonAir(const BlockID* blocks, int count){
+        return active().countNonAir(blocks, count);
+    }
+
+    bool allEqual(const BlockID* blocks, int count){
+        return count <= 1 || active().allEqual(blocks, count);
+    }
+
+    int histogram(const BlockID* blocks, int count, uint32_t* counts, BlockID numIds){
+        return active().histogram(blocks, count, counts, numIds);
+    }
+
+    void highestNonAir(const BlockID* section, int size, int8_t* heights){
+        active().highestNonAir(section, size, heights);
+    }
+}
+}
@@ -0,0 +1,170 @@
+#include "world/SlabPool.h"
+#include "utils/MemoryStats.h"
+#include <cstdlib>
+#include <new>
+#include <stdexcept>
+#ifdef ABYSS_POOL_HUGE_PAGES
+#include <sys/mman.h>
+#endif
+
+namespace AbyssCore {
+
+    // Identificadores de pool para indexar la caché por hilo
+    static std::atomic<int> s_nextPoolId(0);
+
+    /**
+     * Lista de huecos libres de un hilo para un pool. Al terminar el hilo devuelve lo que
+     * tenga a la lista global para que no se pierda.
+     */
+    struct SlabPool::ThreadCache {
+        SlabPool* pool = nullptr;
+        FreeNode* head = nullptr;
+        int count = 0;
+
+        ~ThreadCache(){
+            if(pool == nullptr || head == nullptr){
+                return;
+            }
+            FreeNode* tail = head;
+            while(tail->next != nullptr){
+                tail = tail->next;
+            }
+            pool->releaseList(head, tail);
+            head = nullptr;
+            count = 0;
+        }
+    };
+
+    thread_local SlabPool::ThreadCache SlabPool::s_threadCaches[SlabPool::MAX_POOLS];
+
+    SlabPool::SlabPool(const char* name, std::size_t slotSize, std::size_t alignment)
+    : m_name(name),
+      m_id(s_nextPoolId.fetch_add(1, std::memory_order_relaxed)),
+      m_alignment(alignment < alignof(FreeNode) ? alignof(FreeNode) : alignment),
+      m_freeList(nullptr),
+      m_capacity(0),
+      m_live(0) {
+        if(m_id >= MAX_POOLS){
+            throw std::runtime_error("SlabPool: too many pools");
+        }
+        if(slotSize < sizeof(FreeNode)){
+            slotSize = sizeof(FreeNode);
+        }
+        // Redondeo al alineamiento para que todos los huecos del slab queden alineados
+        m_slotSize = (slotSize + m_alignment - 1) / m_alignment * m_alignment;
+    }
+
+    /**
+     * @brief Reserva un slab nuevo y lo encadena entero a la lista global.
+     *
+     * @note Requiere m_mutex. Suma el slab a MEMORY_POOLS.
+     */
+    void SlabPool::allocateSlab(){
+#ifdef ABYSS_POOL_HUGE_PAGES
+        void* slab = std::aligned_alloc(SLAB_BYTES, SLAB_BYTES);
+        if(slab != nullptr){
+            madvise(slab, SLAB_BYTES, MADV_HUGEPAGE); // Best effort: si el kernel no puede, páginas normales
+        }
+#else
+        void* slab = std::aligned_alloc(m_alignment < 64 ? 64 : m_alignment, SLAB_BYTES);
+#endif
+        if(slab == nullptr){
+            throw std::bad_alloc();
+        }
+        m_slabs.push_back(slab);
+
+        const std::size_t slots = SLAB_BYTES / m_slotSize;
+        char* base = static_cast<char*>(slab);
+        // Encadenamos en orden de dirección: los primeros objetos quedan contiguos
+        for(std::size_t i = slots; i-- > 0;){
+            FreeNode* node = reinterpret_cast<FreeNode*>(base + i * m_slotSize);
+            node->next = m_freeList;
+            m_freeList = node;
+        }
+        m_capacity += slots;
+        MemoryStats::getInstance().add(MEMORY_POOLS, SLAB_BYTES);
+    }
+
+    SlabPool::FreeNode* SlabPool::takeBatch(int& count){
+        std::lock_guard<std::mutex> lock(m_mutex);
+        if(m_freeList == nullptr){
+            allocateSlab();
+        }
+        FreeNode* head = m_freeList;
+        FreeNode* tail = head;
+        count = 1;
+        while(count < BATCH && tail->next != nullptr){
+            tail = tail->next;
+            count++;
+        }
+        m_freeList = tail->next;
+        tail->next = nullptr;
+        return head;
+    }
+
+    void SlabPool::releaseList(FreeNode* head, FreeNode* tail){
+        std::lock_guard<std::mutex> lock(m_mutex);
+        tail->next = m_freeList;
+        m_freeList = head;
+    }
+
+    /**
+     * @brief Devuelve un hueco libre de m_slotSize bytes.
+     *
+     * @return void* Memoria sin construir.
+     * @note Sin lock salvo cuando la caché del hilo está vacía (una vez cada BATCH reservas).
+     */
+    void* SlabPool::allocate(){
+        ThreadCache& cache = s_threadCaches[m_id];
+        cache.pool = this;
+        if(cache.head == nullptr){
+            cache.head = takeBatch(cache.count);
+        }
+        FreeNode* node = cache.head;
+        cache.head = node->next;
+        cache.count--;
+        m_live.fetch_add(1, std::memory_order_relaxed);
+        return node;
+    }
+
+    /**
+     * @brief Devuelve un hueco a la caché del hilo actual.
+     *
+     * @param ptr Memoria obtenida con allocate() de este pool (desde cualquier hilo).
+     * @note Si la caché supera 2 * BATCH huecos se devuelve un lote a la lista global.
+     */
+    void SlabPool::deallocate(void* ptr){
+        if(ptr == nullptr){
+            return;
+        }
+        ThreadCache& cache = s_threadCaches[m_id];
+        cache.pool = this;
+        FreeNode* node = static_cast<FreeNode*>(ptr);
+        node->next = cache.head;
+        cache.head = node;
+        cache.count++;
+        m_live.fetch_sub(1, std::memory_order_relaxed);
+
+        if(cache.count > 2 * BATCH){
+            FreeNode* head = cache.head;
+            FreeNode* tail = head;
+            for(int i = 1; i < BATCH; i++){
+                tail = tail->next;
+            }
+            cache.head = tail->next;
+            cache.count -= BATCH;
+            releaseList(head, tail);
+        }
+    }
+
+    PoolStats SlabPool::getStats() const {
+        PoolStats stats;
+        std::lock_guard<std::mutex> lock(m_mutex);
+        stats.slotSize = m_slotSize;
+        stats.slabs = m_slabs.size();
+        stats.capacity = m_capacity;
+        stats.live = m_live.load(std::memory_order_relaxed);
+        stats.free = stats.capacity - stats.live;
+        return stats;
+    }
+}
@@ -0,0 +1,139 @@
+#include "world/World.h"
+
+namespace AbyssCore {
+
+    World::~World(){
+        std::vector<ChunkColumn*> columns;
+        m_columns.forEach([&columns](ChunkColumn* column){ columns.push_back(column); });
+        for(ChunkColumn* column : columns){
+            delete column;
+        }
+    }
+
+    /**
+     * @brief Devuelve la columna (chunkX, chunkZ), creándola vacía si no existe.
+     *
+     * @note Si dos hilos la crean a la vez gana la primera inserción y la otra se descarta.
+     */
+    ChunkColumn* World::getOrCreateColumn(int chunkX, int chunkZ){
+        EpochGuard guard;
+        const uint64_t key = packColumnKey(chunkX, chunkZ);
+        ChunkColumn* column = m_columns.find(key);
+        if(column != nullptr){
+            return column;
+        }
+        std::unique_ptr<ChunkColumn> created = std::make_unique<ChunkColumn>(chunkX, chunkZ, &m_changes);
+        column = m_columns.insert(key, created.get());
+        if(column == created.get()){
+            created.release(); // Ahora es del mundo
+            growBounds(chunkX, chunkZ);
+        }
+        return column;
+    }
+
+    // Mínimo o máximo atómico; varias columnas pueden crearse a la vez
+    template <typename Better>
+    static void storeIf(std::atomic<int>& bound, int value, Better better){
+        int current = bound.load(std::memory_order_relaxed);
+        while(better(value, current) && !bound.compare_exchange_weak(current, value, std::memory_order_relaxed)){}
+    }
+
+    /**
+     * @brief Amplía la caja de columnas cargadas con una columna nueva.
+     *
+     * @note La caja se publica después de la columna: quien la lea sin ver la columna nueva a lo
+     *       sumo se pierde una columna recién creada, como cualquier lector concurrente.
+     */
+    void World::growBounds(int chunkX, int chunkZ){
+        const auto less = [](int a, int b){ return a < b; };
+        const auto greater = [](int a, int b){ return a > b; };
+        storeIf(m_minChunkX, chunkX, less);
+        storeIf(m_minChunkZ, chunkZ, less);
+        storeIf(m_maxChunkX, chunkX, greater);
+        storeIf(m_maxChunkZ, chunkZ, greater);
+    }
+
+    bool World::getColumnBounds(int& minChunkX, int& minChunkZ, int& maxChunkX, int& maxChunkZ) const {
+        minChunkX = m_minChunkX.load(std::memory_order_relaxed);
+        minChunkZ = m_minChunkZ.load(std::memory_order_relaxed);
+        maxChunkX = m_maxChunkX.load(std::memory_order_relaxed);
+        maxChunkZ = m_maxChunkZ.load(std::memory_order_relaxed);
+        return minChunkX <= maxChunkX && minChunkZ <= maxChunkZ;
+    }
+
+    /**
+     * @brief Descarga una columna: deja de ser visible al instante y se libera por épocas.
+     *
+     * @return true si la columna estaba cargada.
+     */
+    bool World::unloadColumn(int chunkX, int chunkZ){
+        ChunkColumn* column = m_columns.remove(packColumnKey(chunkX, chunkZ));
+        if(column == nullptr){
+            return false;
+        }
+        EpochManager::getInstance().retire(column);
+        return true;
+    }
+
+    BlockID World::getBlock(int x, int y, int z) const {
+        EpochGuard guard;
+        const ChunkColumn* column = m_columns.find(packColumnKey(toChunkCoord(x), toChunkCoord(z)));
+        if(column == nullptr){
+            return 0; // Aire
+        }
+        return column->getBlock(toLocalCoord(x), y, toLocalCoord(z));
+    }
+
+    void World::setBlock(int x, int y, int z, BlockID block){
+        EpochGuard guard;
+        ChunkColumn* column = (block == 0)
+            ? getColumn(toChunkCoord(x), toChunkCoord(z))
+            : getOrCreateColumn(toChunkCoord(x), toChunkCoord(z));
+        if(column != nullptr){
+            column->setBlock(toLocalCoord(x), y, toLocalCoord(z), block);
+        }
+    }
+
+    /**
+     * @brief Vacía la cola de cambios y rearma la notificación de cada sección entregada.
+     *
+     * @param out Secciones modificadas; las de columnas ya descargadas se entregan igualmente.
+     * @note Una escritura que llegue entre el vaciado y el rearme no se pierde: sus sub-cubos ya
+     *       están en las máscaras que el consumidor va a leer en este mismo tick.
+     */
+    void World::drainChanges(std::vector<SectionChange>& out){
+        EpochGuard guard;
+        m_changes.drain(out);
+        for(const SectionChange& change : out){
+            const ChunkColumn* column = getColumn(change.chunkX, change.chunkZ);
+            ChunkSection* section = (column != nullptr) ? column->findSection(change.sectionY) : nullptr;
+            if(section != nullptr){
+                section->clearNotification();
+            }
+        }
+    }
+
+    /**
+     * @brief Mide la memoria del mundo y la añade a las categorías de secciones y columnas.
+     *
+     * @param report Informe al que se suma (normalmente el de MemoryStats::collect()).
+     * @note Las columnas descargadas pendientes en EpochManager no se cuentan.
+     *       Los objetos ChunkSection/ChunkColumn se descuentan porque ya están en los slabs de MEMORY_POOLS.
+     */
+    void World::accountMemory(MemoryReport& report) const {
+        EpochGuard guard;
+        std::size_t sections = 0;
+        std::size_t columns = sizeof(*this) + m_columns.getMemoryUsage();
+        auto account = [&sections, &columns](const ChunkColumn* column){
+            int count = 0;
+            for(int sy = column->getMinSectionY(); sy <= column->getMaxSectionY(); sy++){
+                count += column->findSection(sy) != nullptr;
+            }
+            sections += column->getSectionMemoryUsage() - count * sizeof(ChunkSection);
+            columns += column->getMemoryUsage() - sizeof(ChunkColumn);
+        };
+        m_columns.forEach(account);
+        report.bytes[MEMORY_SECTIONS] += sections;
+        report.bytes[MEMORY_COLUMNS] += columns;
+    }
+}
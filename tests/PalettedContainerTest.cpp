@@ -0,0 +1,71 @@
+#include "world/ChunkSection.h"
+#include "world/PalettedContainer.h"
+#include "world/Epoch.h"
+#include <cstdio>
+
+using namespace AbyssCore;
+
+static int failures = 0;
+
+static void check(bool condition, const char* what){
+    if(!condition){
+        std::printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+/**
+ * @brief Con 17-64 estados a 8 bits no hay ancho menor posible: compact() no debe pedirse.
+ */
+static void testNoUselessCompact(){
+    constexpr int STATES = 20;
+    PalettedContainer container(CHUNK_SECTION_VOLUME);
+    for(int i = 0; i < CHUNK_SECTION_VOLUME; i++){
+        container.set(i, static_cast<BlockID>(1 + i % STATES));
+    }
+    check(container.getBitsPerBlock() == 8, "20 states use 8 bits");
+    check(!container.wantsCompact(), "20 live states at 8 bits do not want a compact");
+
+    // Solo sobreviven 12: caben en 4 bits dejando libre 1/4
+    for(int i = 0; i < CHUNK_SECTION_VOLUME; i++){
+        container.set(i, static_cast<BlockID>(1 + i % 12));
+    }
+    check(container.wantsCompact(), "12 live states at 8 bits want a compact");
+    container.compact();
+    check(container.getBitsPerBlock() == 4, "compact shrinks 12 states to 4 bits");
+    check(!container.wantsCompact(), "a compacted container does not want another compact");
+}
+
+/**
+ * @brief Escrituras repetidas en una sección de 20 estados: in situ, sin publicar contenedores.
+ */
+static void testSectionWritesInPlace(){
+    constexpr int STATES = 20;
+    constexpr int WRITES = 1000;
+    ChunkSection section(0);
+    for(int i = 0; i < CHUNK_SECTION_VOLUME; i++){
+        section.setBlock(i % CHUNK_SECTION_SIZE, i / CHUNK_SECTION_LAYER, (i / CHUNK_SECTION_SIZE) % CHUNK_SECTION_SIZE,
+                         static_cast<BlockID>(1 + i % STATES));
+    }
+    check(section.getBitsPerBlock() == 8, "section with 20 states uses 8 bits");
+
+    // Cada escritura in situ sube la versión una vez; un compact publicaría un contenedor más
+    const uint64_t before = section.getVersion();
+    for(int i = 0; i < WRITES; i++){
+        const int x = i % CHUNK_SECTION_SIZE, z = (i / CHUNK_SECTION_SIZE) % CHUNK_SECTION_SIZE;
+        const BlockID current = section.getBlock(x, 0, z);
+        section.setBlock(x, 0, z, static_cast<BlockID>(1 + current % STATES));
+    }
+    check(section.getVersion() - before == WRITES, "one version per in-place write");
+    check(section.getBitsPerBlock() == 8, "section keeps 8 bits");
+}
+
+int main(){
+    EpochGuard guard;
+    testNoUselessCompact();
+    testSectionWritesInPlace();
+    if(failures == 0){
+        std::printf("PalettedContainerTest: OK\n");
+    }
+    return failures == 0 ? 0 : 1;
+}
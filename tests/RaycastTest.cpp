@@ -0,0 +1,188 @@
+#include "world/Raycast.h"
+#include <cstdio>
+#include <cmath>
+#include <limits>
+#include <random>
+
+using namespace AbyssCore;
+
+static int failures = 0;
+
+static void check(bool condition, const char* what){
+    if(!condition){
+        std::printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+static constexpr int COLUMNS = 4;
+static constexpr int SIZE = COLUMNS * CHUNK_SECTION_SIZE;
+static constexpr int MIN_Y = -2 * CHUNK_SECTION_SIZE;
+static constexpr int MAX_Y = 3 * CHUNK_SECTION_SIZE;
+
+/**
+ * @brief Referencia: DDA vóxel a vóxel con World::getBlock, mismo desempate de ejes que Raycaster.
+ */
+static RayHit referenceCast(const World& world, const Ray& ray){
+    const BlockRegistry& registry = BlockRegistry::getInstance();
+    RayHit result{false, 0, 0, 0, -1, 0, 0.0f};
+    const double length = std::sqrt(double(ray.direction[0]) * ray.direction[0] +
+                                    double(ray.direction[1]) * ray.direction[1] +
+                                    double(ray.direction[2]) * ray.direction[2]);
+    constexpr double INF = std::numeric_limits<double>::infinity();
+    int voxel[3], step[3];
+    double tMax[3], tDelta[3];
+    for(int axis = 0; axis < 3; axis++){
+        const double origin = ray.origin[axis];
+        const double dir = ray.direction[axis] / length;
+        voxel[axis] = static_cast<int>(std::floor(origin));
+        step[axis] = (dir > 0.0) ? 1 : (dir < 0.0) ? -1 : 0;
+        tDelta[axis] = (dir != 0.0) ? std::fabs(1.0 / dir) : INF;
+        tMax[axis] = (dir > 0.0) ? (voxel[axis] + 1 - origin) / dir : (dir < 0.0) ? (voxel[axis] - origin) / dir : INF;
+    }
+    double t = 0.0;
+    int enteredAxis = -1;
+    for(;;){
+        const BlockID block = world.getBlock(voxel[0], voxel[1], voxel[2]);
+        if(registry.getCollisionShape(block) != SHAPE_EMPTY){
+            result = {true, voxel[0], voxel[1], voxel[2],
+                      (enteredAxis < 0) ? -1 : enteredAxis * 2 + (step[enteredAxis] > 0 ? 0 : 1), block, static_cast<float>(t)};
+            return result;
+        }
+        int axis = (tMax[0] < tMax[1]) ? 0 : 1;
+        axis = (tMax[2] < tMax[axis]) ? 2 : axis;
+        t = tMax[axis];
+        if(t > ray.maxDistance){
+            return result;
+        }
+        voxel[axis] += step[axis];
+        tMax[axis] += tDelta[axis];
+        enteredAxis = axis;
+    }
+}
+
+/**
+ * @brief Mundo con secciones vacías, uniformes de piedra, uniformes de agua (no detiene) y mezcladas.
+ */
+static void buildWorld(World& world, std::mt19937& rng){
+    const BlockRegistry& registry = BlockRegistry::getInstance();
+    const BlockID stone = registry.getBaseState(BLOCK_STONE);
+    const BlockID water = registry.getBaseState(BLOCK_WATER);
+    for(int cz = 0; cz < COLUMNS; cz++){
+        for(int cx = 0; cx < COLUMNS; cx++){
+            ChunkColumn* column = world.getOrCreateColumn(cx, cz);
+            for(int sy = MIN_Y / CHUNK_SECTION_SIZE; sy < MAX_Y / CHUNK_SECTION_SIZE; sy++){
+                const int y0 = sy * CHUNK_SECTION_SIZE;
+                switch(rng() % 4){
+                    case 0:
+                        column->getSection(sy);
+                        break;
+                    case 1:
+                        column->fillBox(0, y0, 0, CHUNK_SECTION_MASK, y0 + CHUNK_SECTION_MASK, CHUNK_SECTION_MASK, stone);
+                        break;
+                    case 2:
+                        column->fillBox(0, y0, 0, CHUNK_SECTION_MASK, y0 + CHUNK_SECTION_MASK, CHUNK_SECTION_MASK, water);
+                        break;
+                    default:
+                        for(int i = 0; i < CHUNK_SECTION_VOLUME / 64; i++){
+                            column->setBlock(rng() % CHUNK_SECTION_SIZE, y0 + static_cast<int>(rng() % CHUNK_SECTION_SIZE),
+                                             rng() % CHUNK_SECTION_SIZE, (rng() % 2) ? stone : water);
+                        }
+                        break;
+                }
+            }
+        }
+    }
+}
+
+static bool sameHit(const RayHit& a, const RayHit& b){
+    if(a.hit != b.hit){
+        return false;
+    }
+    if(!a.hit){
+        return true;
+    }
+    return a.x == b.x && a.y == b.y && a.z == b.z && a.face == b.face && a.block == b.block &&
+           std::fabs(a.distance - b.distance) <= 1e-3f * (1.0f + a.distance);
+}
+
+/**
+ * @brief cast() frente a la referencia en rayos aleatorios y alineados con los ejes.
+ */
+static void testAgainstReference(){
+    std::mt19937 rng(20);
+    std::uniform_real_distribution<float> coord(-8.0f, SIZE + 8.0f), height(MIN_Y - 8.0f, MAX_Y + 8.0f), dir(-1.0f, 1.0f);
+    int mismatches = 0, hits = 0;
+    for(int seed = 0; seed < 4; seed++){
+        World world;
+        buildWorld(world, rng);
+        Raycaster raycaster(world);
+        for(int i = 0; i < 4000; i++){
+            Ray ray{{coord(rng), height(rng), coord(rng)}, {dir(rng), dir(rng), dir(rng)}, 40.0f + 60.0f * (rng() % 2)};
+            // Uno de cada cuatro, alineado con un eje
+            if(i % 4 == 0){
+                const int axis = rng() % 3;
+                for(int a = 0; a < 3; a++){
+                    ray.direction[a] = (a == axis) ? ((rng() % 2) ? 1.0f : -1.0f) : 0.0f;
+                }
+            }
+            if(ray.direction[0] == 0.0f && ray.direction[1] == 0.0f && ray.direction[2] == 0.0f){
+                continue;
+            }
+            const RayHit expected = referenceCast(world, ray);
+            const RayHit got = raycaster.cast(ray);
+            hits += expected.hit;
+            if(!sameHit(expected, got)){
+                if(mismatches < 5){
+                    std::printf("  ray (%g %g %g) dir (%g %g %g): expected %d (%d %d %d) face %d t %g, got %d (%d %d %d) face %d t %g\n",
+                                ray.origin[0], ray.origin[1], ray.origin[2], ray.direction[0], ray.direction[1], ray.direction[2],
+                                expected.hit, expected.x, expected.y, expected.z, expected.face, expected.distance,
+                                got.hit, got.x, got.y, got.z, got.face, got.distance);
+                }
+                mismatches++;
+            }
+        }
+    }
+    check(mismatches == 0, "cast matches the voxel-by-voxel DDA");
+    check(hits > 1000, "enough rays hit something");
+}
+
+/**
+ * @brief Distancias infinitas, enormes o NaN hacia espacio sin cargar terminan sin alcanzar nada.
+ */
+static void testUnboundedRays(){
+    World world;
+    world.getOrCreateColumn(0, 0)->getSection(0);
+    Raycaster raycaster(world);
+    const float inf = std::numeric_limits<float>::infinity();
+    const float nan = std::numeric_limits<float>::quiet_NaN();
+    const Ray rays[] = {
+        {{8.5f, 8.5f, 8.5f}, {1.0f, 0.0f, 0.0f}, inf},
+        {{8.5f, 8.5f, 8.5f}, {0.0f, 1.0f, 0.0f}, inf},
+        {{8.5f, 8.5f, 8.5f}, {0.0f, -1.0f, 0.0f}, 1e30f},
+        {{8.5f, 8.5f, 8.5f}, {0.3f, 0.01f, -0.7f}, inf},
+        {{-500.5f, 3.5f, 700.5f}, {0.0f, 1.0f, 0.0f}, inf},
+        {{8.5f, 8.5f, 8.5f}, {1.0f, 1.0f, 1.0f}, nan},
+        {{8.5f, 8.5f, 8.5f}, {nan, 1.0f, 1.0f}, 10.0f},
+        {{inf, 8.5f, 8.5f}, {1.0f, 1.0f, 1.0f}, 10.0f},
+        {{3e9f, 8.5f, 8.5f}, {-1.0f, 0.0f, 0.0f}, inf},
+    };
+    for(const Ray& ray : rays){
+        check(!raycaster.cast(ray).hit, "unbounded ray into empty space terminates without a hit");
+    }
+    // Un rayo infinito que sí llega a un bloque lo encuentra
+    world.setBlock(40, 8, 8, BlockRegistry::getInstance().getBaseState(BLOCK_STONE));
+    Raycaster again(world);
+    const RayHit hit = again.cast({{8.5f, 8.5f, 8.5f}, {1.0f, 0.0f, 0.0f}, inf});
+    check(hit.hit && hit.x == 40 && hit.face == FACE_NEG_X, "infinite ray still finds a block in range");
+}
+
+int main(){
+    BlockRegistry::getInstance().init([](const std::string&){ return 0; });
+    testAgainstReference();
+    testUnboundedRays();
+    if(failures == 0){
+        std::printf("RaycastTest: OK\n");
+    }
+    return failures == 0 ? 0 : 1;
+}
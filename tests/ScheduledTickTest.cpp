@@ -0,0 +1,209 @@
+#include "world/ScheduledTick.h"
+#include "world/BlockRegistry.h"
+#include "world/Epoch.h"
+#include <cstdio>
+#include <random>
+#include <unordered_set>
+#include <vector>
+
+using namespace AbyssCore;
+
+static int failures = 0;
+
+static void check(bool condition, const char* what){
+    if(!condition){
+        std::printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+static constexpr BlockTypeID TICK_TYPE = 1;
+
+/**
+ * @brief TickKeySet contra std::unordered_set con pocas claves y muchas altas/bajas: fuerza
+ *        colisiones, sondeos que dan la vuelta a la tabla y borrados con desplazamiento hacia atrás.
+ */
+static void testKeySetAgainstModel(){
+    std::mt19937 rng(1234);
+    std::vector<uint64_t> keys;
+    for(int i = 0; i < 40; i++){
+        // Claves con la misma forma que packTickKey: misma columna, y e índice local variables
+        keys.push_back((static_cast<uint64_t>(i % 5) << 32) | (static_cast<uint64_t>(TICK_TYPE) << 10) | (i * 7u % 1024u));
+    }
+    TickKeySet set;
+    std::unordered_set<uint64_t> model;
+    bool consistent = true, results = true;
+    for(int op = 0; op < 200000; op++){
+        const uint64_t key = keys[rng() % keys.size()];
+        if(rng() % 2 == 0){
+            results &= set.insert(key) == model.insert(key).second;
+        }else{
+            set.erase(key);
+            model.erase(key);
+        }
+        consistent &= set.size() == model.size();
+        if(op % 64 == 0){
+            for(const uint64_t probe : keys){
+                consistent &= set.contains(probe) == (model.count(probe) != 0);
+            }
+        }
+    }
+    check(results, "TickKeySet insert reports the same as std::unordered_set");
+    check(consistent, "TickKeySet contents match std::unordered_set after every operation");
+}
+
+/**
+ * @brief Un (posición, tipo) ya programado no se duplica; tras ejecutarse puede volver a programarse.
+ */
+static void testDedup(){
+    World world;
+    EpochGuard guard;
+    world.getOrCreateColumn(0, 0);
+    TickScheduler scheduler(world);
+    int runs = 0;
+    scheduler.setHandler(TICK_TYPE, [&](int, int, int, BlockTypeID){ runs++; });
+
+    check(scheduler.schedule(3, 10, 4, TICK_TYPE, 2), "first schedule is accepted");
+    check(!scheduler.schedule(3, 10, 4, TICK_TYPE, 1), "a duplicate schedule is rejected");
+    check(scheduler.schedule(3, 11, 4, TICK_TYPE, 2), "another y is a different tick");
+    check(!scheduler.schedule(CHUNK_SECTION_SIZE, 0, 0, TICK_TYPE, 1), "an unloaded column rejects ticks");
+    scheduler.tick();
+    check(runs == 0, "nothing runs before its delay");
+    scheduler.tick();
+    check(runs == 2, "both ticks run once at their due tick");
+    check(!scheduler.isScheduled(3, 10, 4, TICK_TYPE), "an executed tick is no longer scheduled");
+    check(scheduler.schedule(3, 10, 4, TICK_TYPE, 1), "an executed tick can be scheduled again");
+}
+
+/**
+ * @brief Con un presupuesto pequeño los ticks sobrantes pasan al siguiente tick() sin perder el orden:
+ *        vencimientos no decrecientes y, a igual vencimiento en una columna, orden de llegada.
+ */
+static void testBudgetCarryOver(){
+    constexpr int COLUMNS = 3;
+    World world;
+    EpochGuard guard;
+    for(int chunkX = 0; chunkX < COLUMNS; chunkX++){
+        world.getOrCreateColumn(chunkX, 0);
+    }
+    TickScheduler scheduler(world);
+    scheduler.setBudget(7);
+
+    // Una posición por tick programado: el manejador identifica el tick por su posición
+    struct Scheduled { uint64_t due; int order; int chunkX; };
+    std::vector<Scheduled> scheduled;
+    std::vector<int> executed;
+    const auto index = [](int x, int y, int z){ return (y * COLUMNS * CHUNK_SECTION_SIZE + x) * CHUNK_SECTION_SIZE + z; };
+    std::vector<int> byPosition(index(0, 8, 0), -1);
+    scheduler.setHandler(TICK_TYPE, [&](int x, int y, int z, BlockTypeID){ executed.push_back(byPosition[index(x, y, z)]); });
+
+    std::mt19937 rng(99);
+    int order = 0;
+    bool budget = true;
+    for(int round = 0; round < 6; round++){
+        for(int i = 0; i < 40; i++){
+            const int x = static_cast<int>(rng() % (COLUMNS * CHUNK_SECTION_SIZE));
+            const int y = static_cast<int>(rng() % 8);
+            const int z = static_cast<int>(rng() % CHUNK_SECTION_SIZE);
+            const int delay = 1 + static_cast<int>(rng() % 4);
+            if(scheduler.schedule(x, y, z, TICK_TYPE, delay)){
+                byPosition[index(x, y, z)] = static_cast<int>(scheduled.size());
+                scheduled.push_back({scheduler.getCurrentTick() + delay, order++, World::toChunkCoord(x)});
+            }
+        }
+        scheduler.tick();
+        budget &= scheduler.getExecutedCount() <= 7;
+    }
+    for(int i = 0; i < 200 && scheduler.getPendingCount() > 0; i++){
+        scheduler.tick();
+        budget &= scheduler.getExecutedCount() <= 7;
+    }
+
+    bool ordered = true, arrival = true;
+    for(std::size_t i = 1; i < executed.size(); i++){
+        const Scheduled& previous = scheduled[executed[i - 1]];
+        const Scheduled& current = scheduled[executed[i]];
+        ordered &= previous.due <= current.due;
+        if(previous.due == current.due && previous.chunkX == current.chunkX){
+            arrival &= previous.order < current.order;
+        }
+    }
+    check(executed.size() == scheduled.size(), "every scheduled tick eventually runs");
+    check(ordered, "carried-over ticks still run in due order");
+    check(arrival, "equal dues in one column run in arrival order");
+    check(budget, "a tick() never runs more than the budget");
+    check(scheduler.getPendingCount() == 0, "nothing is left pending");
+}
+
+/**
+ * @brief Una columna descargada sin dropColumn y recargada (aunque el pool reutilice la dirección)
+ *        no hereda los ticks viejos; dropColumn explícito también los suelta.
+ */
+static void testDropAndReload(){
+    World world;
+    TickScheduler scheduler(world);
+    std::vector<int> ranY;
+    scheduler.setHandler(TICK_TYPE, [&](int, int y, int, BlockTypeID){ ranY.push_back(y); });
+
+    {
+        EpochGuard guard;
+        world.getOrCreateColumn(0, 0);
+    }
+    check(scheduler.schedule(1, 1, 1, TICK_TYPE, 5), "old tick scheduled");
+    check(scheduler.schedule(1, 2, 1, TICK_TYPE, 5), "old tick scheduled (shared position with the reload)");
+    world.unloadColumn(0, 0);
+    for(int i = 0; i < 4; i++){
+        EpochManager::getInstance().collect();
+    }
+    {
+        EpochGuard guard;
+        world.getOrCreateColumn(0, 0);
+    }
+    check(!scheduler.isScheduled(1, 1, 1, TICK_TYPE), "a reloaded column does not report old ticks");
+    check(scheduler.schedule(1, 2, 1, TICK_TYPE, 2), "the reloaded column accepts a tick at an old position");
+    check(scheduler.schedule(1, 3, 1, TICK_TYPE, 2), "the reloaded column accepts new ticks");
+    for(int i = 0; i < 10; i++){
+        scheduler.tick();
+    }
+    bool onlyNew = ranY.size() == 2;
+    for(const int y : ranY){
+        onlyNew &= y == 2 || y == 3;
+    }
+    check(onlyNew, "only the ticks scheduled after the reload run");
+
+    // Descarga sin recarga: el bloque se suelta al llegar su aviso
+    ranY.clear();
+    check(scheduler.schedule(1, 4, 1, TICK_TYPE, 2), "tick before a plain unload");
+    world.unloadColumn(0, 0);
+    for(int i = 0; i < 4; i++){
+        scheduler.tick();
+    }
+    check(ranY.empty(), "ticks of an unloaded column do not run");
+    check(scheduler.getPendingCount() == 0, "the stale bucket is released when its wakeup comes due");
+
+    // dropColumn explícito
+    {
+        EpochGuard guard;
+        world.getOrCreateColumn(0, 0);
+    }
+    check(scheduler.schedule(1, 5, 1, TICK_TYPE, 2), "tick before dropColumn");
+    scheduler.dropColumn(0, 0);
+    check(!scheduler.isScheduled(1, 5, 1, TICK_TYPE), "dropColumn forgets the column's ticks");
+    check(scheduler.getPendingCount() == 0, "dropColumn releases the bucket at once");
+    for(int i = 0; i < 4; i++){
+        scheduler.tick();
+    }
+    check(ranY.empty(), "dropped ticks do not run");
+}
+
+int main(){
+    BlockRegistry::getInstance().init([](const std::string&){ return 0; });
+    testKeySetAgainstModel();
+    testDedup();
+    testBudgetCarryOver();
+    testDropAndReload();
+    if(failures == 0){
+        std::printf("ScheduledTickTest: OK\n");
+    }
+    return failures == 0 ? 0 : 1;
+}
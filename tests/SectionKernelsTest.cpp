@@ -0,0 +1,152 @@
+#include "world/SectionKernels.h"
+#include "world/ChunkSection.h"
+#include <cstdio>
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+using namespace AbyssCore;
+using SectionKernels::Isa;
+
+static int failures = 0;
+
+static void check(bool condition, const char* what){
+    if(!condition){
+        std::printf("FAIL: %s\n", what);
+        failures++;
+    }
+}
+
+// Longitudes alrededor de los pasos vectoriales (4, 8, 16, 32 bloques) y de una sección entera
+static const int COUNTS[] = {
+    0, 1, 3, 4, 5, 7, 8, 9, 15, 16, 17, 31, 32, 33, 63, 64, 65, 100, 255, 256, 257,
+    CHUNK_SECTION_VOLUME - 1, CHUNK_SECTION_VOLUME, CHUNK_SECTION_VOLUME + 3
+};
+
+/**
+ * @brief Rellena con rachas de longitud aleatoria: unas largas (atajo de rachas del histograma),
+ *        otras de 1 bloque; 'airChance' de cada 8 rachas son de aire.
+ */
+static void fillRuns(std::vector<BlockID>& blocks, std::mt19937& rng, BlockID maxId, int maxRun, int airChance){
+    std::size_t i = 0;
+    while(i < blocks.size()){
+        const BlockID id = (static_cast<int>(rng() % 8) < airChance) ? 0 : static_cast<BlockID>(1 + rng() % maxId);
+        const std::size_t run = 1 + rng() % maxRun;
+        for(std::size_t k = 0; k < run && i < blocks.size(); k++){
+            blocks[i++] = id;
+        }
+    }
+}
+
+/**
+ * @brief countNonAir, allEqual e histogram de 'isa' contra la versión escalar, con punteros
+ *        desalineados y longitudes que no son múltiplo del paso vectorial.
+ */
+static void testLinearKernels(Isa isa, std::mt19937& rng){
+    const std::string name = SectionKernels::isaName(isa);
+    std::vector<BlockID> blocks(CHUNK_SECTION_VOLUME + 16);
+    bool nonAir = true, equal = true, counts = true, outOfRange = true;
+    for(int round = 0; round < 40; round++){
+        const int maxRun = (round % 4 == 0) ? 1 : (round % 4 == 1) ? 9 : (round % 4 == 2) ? 40 : 600;
+        // IDs hasta numIds + 4: una parte de las rachas queda fuera de rango
+        const BlockID numIds = static_cast<BlockID>(1 + rng() % 64);
+        fillRuns(blocks, rng, numIds + 4, maxRun, static_cast<int>(rng() % 9));
+        for(const int count : COUNTS){
+            const BlockID* data = blocks.data() + rng() % 8;
+
+            SectionKernels::setIsa(Isa::Scalar);
+            const int expectedNonAir = SectionKernels::countNonAir(data, count);
+            std::vector<uint32_t> expectedCounts(numIds, 5);
+            const int expectedOut = SectionKernels::histogram(data, count, expectedCounts.data(), numIds);
+
+            SectionKernels::setIsa(isa);
+            nonAir &= SectionKernels::countNonAir(data, count) == expectedNonAir;
+            std::vector<uint32_t> actualCounts(numIds, 5);
+            outOfRange &= SectionKernels::histogram(data, count, actualCounts.data(), numIds) == expectedOut;
+            counts &= actualCounts == expectedCounts;
+        }
+
+        // allEqual: todo igual, o una única diferencia en cualquier posición (cuerpo vectorial o cola)
+        for(const int count : COUNTS){
+            if(count == 0){
+                continue;
+            }
+            std::vector<BlockID> uniform(count, static_cast<BlockID>(rng() % 4));
+            if(rng() % 3 != 0){
+                uniform[rng() % count] ^= static_cast<BlockID>(1 + rng() % 3);
+            }
+            SectionKernels::setIsa(Isa::Scalar);
+            const bool expected = SectionKernels::allEqual(uniform.data(), count);
+            SectionKernels::setIsa(isa);
+            equal &= SectionKernels::allEqual(uniform.data(), count) == expected;
+        }
+    }
+    check(nonAir, ("countNonAir " + name + " matches scalar").c_str());
+    check(equal, ("allEqual " + name + " matches scalar").c_str());
+    check(counts, ("histogram " + name + " counts match scalar").c_str());
+    check(outOfRange, ("histogram " + name + " out-of-range total matches scalar").c_str());
+}
+
+/**
+ * @brief highestNonAir de 'isa' contra la escalar para secciones de 8^3, 16^3 y 32^3: columnas vacías,
+ *        llenas, con un solo bloque y con alturas aleatorias.
+ *
+ * @note Los kernels vectoriales solo aceptan capas de hasta CHUNK_SECTION_LAYER (el resto cae a escalar),
+ *       así que el 32^3 vectorial solo se ejercita en el ejecutable compilado con secciones de 32.
+ */
+static void testHighestNonAir(Isa isa, std::mt19937& rng){
+    const std::string name = SectionKernels::isaName(isa);
+    for(const int size : {8, 16, 32}){
+        const int layer = size * size;
+        std::vector<BlockID> section(static_cast<std::size_t>(layer) * size);
+        std::vector<int8_t> expected(layer), actual(layer);
+        bool same = true;
+        for(int round = 0; round < 20; round++){
+            std::fill(section.begin(), section.end(), 0);
+            for(int column = 0; column < layer; column++){
+                const int kind = static_cast<int>(rng() % 5);
+                for(int y = 0; y < size; y++){
+                    BlockID& block = section[y * layer + column];
+                    switch(kind){
+                        case 0: break;                                                          // Vacía
+                        case 1: block = 1; break;                                               // Llena
+                        case 2: block = (y == column % size) ? 7 : 0; break;                    // Un bloque
+                        case 3: block = (rng() % 4 == 0) ? static_cast<BlockID>(1 + rng() % 300) : 0; break;
+                        default: block = (y < static_cast<int>(rng() % (size + 1))) ? 2 : 0; break;
+                    }
+                }
+            }
+            SectionKernels::setIsa(Isa::Scalar);
+            SectionKernels::highestNonAir(section.data(), size, expected.data());
+            SectionKernels::setIsa(isa);
+            std::fill(actual.begin(), actual.end(), 100);
+            SectionKernels::highestNonAir(section.data(), size, actual.data());
+            same &= actual == expected;
+        }
+        check(same, ("highestNonAir " + name + " matches scalar at " + std::to_string(size) + "^3").c_str());
+    }
+}
+
+int main(){
+    const Isa best = SectionKernels::detectIsa();
+    std::mt19937 rng(2024);
+    std::string tested;
+    for(const Isa isa : {Isa::SSE41, Isa::AVX2}){
+        if(static_cast<int>(isa) > static_cast<int>(best)){
+            std::printf("SectionKernelsTest: %s not supported, skipped\n", SectionKernels::isaName(isa));
+            continue;
+        }
+        SectionKernels::setIsa(isa);
+        check(SectionKernels::getIsa() == isa, "setIsa selects a supported ISA");
+        testLinearKernels(isa, rng);
+        testHighestNonAir(isa, rng);
+        tested += std::string(tested.empty() ? "" : ", ") + SectionKernels::isaName(isa);
+    }
+    SectionKernels::setIsa(best);
+    if(failures == 0){
+        std::printf("SectionKernelsTest: OK (%d^3 build, %s vs Scalar)\n", CHUNK_SECTION_SIZE,
+                    tested.empty() ? "nothing" : tested.c_str());
+    }
+    return failures == 0 ? 0 : 1;
+}